@@ -0,0 +1,191 @@
+#ifndef BFGEN_H__
+#define BFGEN_H__
+
+/**
+* bfgen - BF code emitter, the code-generation layer of the planned tcc BF
+* target.
+*
+* The emitter tracks the head position at generation time. A position is
+* an (anchor, offset) pair: anchor 0 is the absolute tape, every other
+* anchor is a place the head reached through a glide ([>>>]) and whose
+* address is not known statically.
+*/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <bftypes.h>
+
+#define BFG_STATIC_ANCHOR 0
+
+typedef struct bfg_loop_frame {
+    int anchor;
+    long head;
+} bfg_loop_frame_t;
+
+DECL_VEC(bfg_loop_frame_t);
+
+/// Source of the code in [start, end): see bfg_locate()
+typedef struct bfg_map_entry {
+    size_t start;
+    size_t end;
+    const char* file;
+    int line;
+    const char* function;
+} bfg_map_entry_t;
+
+DECL_VEC(bfg_map_entry_t);
+
+typedef struct bfg {
+    VEC_TYPE(char) code;
+    VEC_TYPE(bfg_loop_frame_t) loops;
+    /// Source map; the last entry is open (end not set yet)
+    VEC_TYPE(bfg_map_entry_t) map;
+    /// Head position relative to `anchor`
+    long head;
+    int anchor;
+    int anchors;
+    /// First generation error, NULL if there was none
+    const char* error;
+} bfg_t;
+
+void bfg_init(bfg_t* g);
+void bfg_free(bfg_t* g);
+
+/// Returns the generated code as a C string (still owned by g)
+const char* bfg_code(bfg_t* g);
+
+/// Records the first generation error
+void bfg_fail(bfg_t* g, const char* error);
+
+/// Appends n copies of c without touching the head bookkeeping
+void bfg_put(bfg_t* g, char c, long n);
+
+/// Appends a comment; BF command characters in it are blanked out
+void bfg_comment(bfg_t* g, const char* text);
+
+/**
+* Attributes the code emitted from now on to file:line in function, for the
+* source map. The strings are not copied and must outlive g.
+*/
+void bfg_locate(bfg_t* g, const char* file, int line, const char* function);
+
+/// bfg_locate() at the calling C line
+#define BFG_LOCATE(g) bfg_locate((g), __FILE__, __LINE__, __func__)
+
+/**
+* Writes the source map: a "# bfmap 1" line, then one line per range,
+* "<start> <end> <file>:<line> <function>", with byte offsets into the code.
+* ibf's profiler and debugger read it from <program>.bfmap.
+*/
+bool bfg_write_map(bfg_t* g, FILE* f);
+
+/// Moves the head by delta cells (works from a dynamic anchor too)
+void bfg_move_rel(bfg_t* g, long delta);
+
+/// Moves the head to the absolute cell
+void bfg_goto(bfg_t* g, bfg_cell_t cell);
+
+/// Declares that the head is at the absolute cell now
+void bfg_rebase(bfg_t* g, bfg_cell_t cell);
+
+/// Allocates a fresh dynamic anchor
+int bfg_new_anchor(bfg_t* g);
+
+/// Declares that the head is `offset` cells away from `anchor`
+void bfg_set_anchor(bfg_t* g, int anchor, long offset);
+
+/// Glide: [>>>...] with the given stride (negative goes left).
+/// The head ends up on a fresh dynamic anchor.
+void bfg_glide(bfg_t* g, long stride);
+
+/// Clearing glide: [->>>...]; zeroes the chain of marks it walks over
+void bfg_glide_clear(bfg_t* g, long stride);
+
+/// Opens a loop on the current cell
+void bfg_loop(bfg_t* g);
+
+/// Closes a loop; the head must be back where the '[' was
+void bfg_end(bfg_t* g);
+
+/// goto(cell) + '['
+void bfg_while(bfg_t* g, bfg_cell_t cell);
+
+/// goto(cell) + ']'
+void bfg_end_at(bfg_t* g, bfg_cell_t cell);
+
+/**
+* Non-destructive "if (cell == 0)". `flag` and the cell after it at the
+* same distance (flag + (flag - cell)) must be zero; the body starts with
+* the head on the already cleared flag and may use any static cells. Both
+* paths leave the head on that second cell, so it costs a constant number
+* of ops.
+*/
+void bfg_if_zero(bfg_t* g, bfg_cell_t cell, bfg_cell_t flag);
+
+/// Closes bfg_if_zero; arguments must match the opening call
+void bfg_end_if_zero(bfg_t* g, bfg_cell_t cell, bfg_cell_t flag);
+
+/// Emits the body of case `index` of bfg_switch (index == count: default)
+typedef void (*bfg_case_fn)(bfg_t* g, int index, void* ctx);
+
+/**
+* switch (value) over the cases 0 .. count - 1 (count <= 255) plus a
+* default, decoded in one pass over the value cell instead of a compare
+* chain: one nested loop per case, each taking one unit off the value, so
+* reaching case k costs O(k) ops. `flag` must be zero. The value is
+* consumed; the cases start with value and flag zero and must leave them
+* so.
+*/
+void bfg_switch(
+    bfg_t* g,
+    bfg_cell_t value,
+    bfg_cell_t flag,
+    int count,
+    bfg_case_fn emit_case,
+    void* ctx
+);
+
+/// Adds delta to the cell (mod 256, the shorter spelling is chosen)
+void bfg_add(bfg_t* g, bfg_cell_t cell, int delta);
+
+/// Adds delta to the cell under the head
+void bfg_add_here(bfg_t* g, int delta);
+
+/// [-]
+void bfg_clear(bfg_t* g, bfg_cell_t cell);
+
+/// [-] on the cell under the head
+void bfg_clear_here(bfg_t* g);
+
+/// Stores a constant into the cell
+void bfg_set(bfg_t* g, bfg_cell_t cell, int value);
+
+/// Destructive transfer: src[- dst[i] += mul[i]]
+void bfg_transfer(
+    bfg_t* g,
+    bfg_cell_t src,
+    size_t n,
+    const bfg_cell_t* dst,
+    const int* mul
+);
+
+/// dst += src, src becomes zero
+void bfg_move(bfg_t* g, bfg_cell_t src, bfg_cell_t dst);
+
+/**
+* dst[i] += src[i], src[i] becomes zero, for i < n: the block copy of the
+* BF target (memcpy into zeroed cells). It emits one transfer loop per
+* cell, all with the same distance and a single '>' between them, a run
+* ibf and bfvm execute as one block-move op instead of value iterations
+* per cell. The cells are moved in ascending order, so the ranges must not
+* overlap unless dst < src. The head ends on src + n - 1.
+*/
+void bfg_move_block(bfg_t* g, bfg_cell_t src, bfg_cell_t dst, long n);
+
+/// dst += src, src is preserved (through the zero cell tmp)
+void bfg_copy(bfg_t* g, bfg_cell_t src, bfg_cell_t dst, bfg_cell_t tmp);
+
+/// '.' on the cell
+void bfg_output(bfg_t* g, bfg_cell_t cell);
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef BFGEN_BENCH_H__
+#define BFGEN_BENCH_H__
+
+/// Prints the executed-op cost of every bfint routine; returns the exit code
+int run_bfint_bench(void);
+
+#endif
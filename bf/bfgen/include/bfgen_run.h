@@ -0,0 +1,20 @@
+#ifndef BFGEN_RUN_H__
+#define BFGEN_RUN_H__
+
+#include <stdbool.h>
+
+/**
+* Runs generated code in ibf's evaluator inside this process, with the
+* program's output going to stdout. The code goes from the emitter to the
+* interpreter without a .b file. Where ibf cannot be built (it needs
+* computed goto) bfvm runs the code instead.
+*
+* With dir set the program runs in that directory, so ibf maps the tape
+* image written there (bfg_image_write) and pages it swaps out go there as
+* well. bfvm cannot load an image and refuses dir.
+*
+* Returns false if the program could not be run.
+*/
+bool bfg_run(const char* code, const char* dir);
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef BFGEN_TESTS_H__
+#define BFGEN_TESTS_H__
+
+void run_bfgen_tests(void);
+void run_bfint_tests(void);
+
+#endif
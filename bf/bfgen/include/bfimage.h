@@ -0,0 +1,52 @@
+#ifndef BFIMAGE_H__
+#define BFIMAGE_H__
+
+/**
+* Preloaded tape images.
+*
+* Initialized data (Doom's tables.c and info.c) does not have to be spelled
+* out as '+' runs that the program executes at startup: it goes into an
+* image of the initial tape, written next to the program in the page
+* directory format of ibf and bld. There is one file per page, named by the
+* page number ("%016lx"), and it holds the page's first cells; the cells
+* past the end of a file are zero. ibf maps the files when it starts.
+*/
+
+#include <bfmem.h>
+
+/// Cells per page file, ibf's PAGE_SIZE (industrial-bf/evaluator/config.h)
+#define BFG_IMAGE_PAGE_SIZE 0x10000000L
+
+typedef struct bfg_image {
+    /// Cells 0 .. length - 1 of the initial tape, the rest is zero
+    VEC_TYPE(char) cells;
+} bfg_image_t;
+
+void bfg_image_init(bfg_image_t* image);
+void bfg_image_free(bfg_image_t* image);
+
+/// Sets the initial value of a cell; false if out of memory
+bool bfg_image_set(bfg_image_t* image, bfg_cell_t cell, uint8_t value);
+
+/// Initial value of a cell
+uint8_t bfg_image_get(const bfg_image_t* image, bfg_cell_t cell);
+
+/**
+* Puts n bytes of data at `address` of the tree memory (bfg_mem_cell), as
+* if the program had stored them. False if they do not fit.
+*/
+bool bfg_image_preload(
+    bfg_image_t* image,
+    const bfg_mem_t* mem,
+    unsigned long address,
+    const void* data,
+    size_t n
+);
+
+/**
+* Writes the page files into the directory (which must exist). Trailing
+* zero cells are left out, a page without data gets no file.
+*/
+bool bfg_image_write(const bfg_image_t* image, const char* dir);
+
+#endif
@@ -0,0 +1,270 @@
+#ifndef BFINT_H__
+#define BFINT_H__
+
+/**
+* Multi-byte integer arithmetic on 8-bit cells (int, long long, fixed_t).
+*
+* A number is `n` consecutive cells, least significant byte first. All
+* numbers live in the register area of a bfg_alu_t: `registers` slots of
+* `width` bytes followed by two lanes of the same size that stay zero
+* between operations. The lanes give every byte x the flag/zero pair
+* bfg_if_zero needs (x + span, x + 2 * span), so a carry test costs a
+* constant number of ops wherever the byte is.
+*
+* Routines take the first cell of each operand and a byte count and may
+* use any register below BFG_ALU_USER as scratch. Unless stated otherwise
+* source operands are consumed (left zero) and results overwrite the
+* destination, like bfg_move.
+*
+* Carries are lazy: adding a byte only bumps a pending-carry counter of
+* the next byte when it wraps, and the counters are folded in by one
+* normalization pass at the end (bfg_int_flush). Multiplication keeps the
+* counters pending across all partial products.
+*/
+
+#include <bfgen.h>
+
+#define BFG_ALU_MAX_WIDTH 8
+
+/// Registers reserved for the routines themselves
+enum {
+    /// Pending carries/borrows of bfg_int_add/bfg_int_sub
+    BFG_ALU_CARRY,
+    /// Restore buffer of bfg_int_copy
+    BFG_ALU_TMP,
+    /// Loose byte cells (counters, bits, flags)
+    BFG_ALU_BYTE,
+    /// Pending carries of the multiplication accumulator
+    BFG_ALU_PENDING,
+    /// Copy of the operand being added
+    BFG_ALU_ARG,
+    /// Shifted multiplicand, trial difference of the division
+    BFG_ALU_WORK,
+    BFG_ALU_USER
+};
+
+typedef struct bfg_alu {
+    bfg_cell_t base;
+    int registers;
+    int width;
+    /// registers * width, the distance to the flag lane
+    long span;
+} bfg_alu_t;
+
+/// No cell (for optional carry/borrow outputs)
+#define BFG_NO_CELL (-1L)
+
+/**
+* Describes a register area at `base` with `registers` registers
+* (including the reserved ones) of `width` bytes. It takes
+* 3 * registers * width zero cells. Returns false on bad parameters.
+*/
+bool bfg_alu_init(bfg_alu_t* alu, bfg_cell_t base, int registers, int width);
+
+/// First cell of register r
+bfg_cell_t bfg_alu_reg(const bfg_alu_t* alu, int r);
+
+/// Number of tape cells the area occupies
+long bfg_alu_cells(const bfg_alu_t* alu);
+
+/// x = 0
+void bfg_int_clear(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int n);
+
+/// x = value (mod 256^n)
+void bfg_int_set(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int n, uint64_t value);
+
+/// dst = src, src becomes zero
+void bfg_int_move(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t dst, bfg_cell_t src, int n);
+
+/// dst = src, src is preserved
+void bfg_int_copy(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t dst, bfg_cell_t src, int n);
+
+/**
+* dst += src without normalization: wraps of byte i are counted in
+* pending[i + 1], a wrap of the top byte increments `out` (if given).
+* src is consumed.
+*/
+void bfg_int_add_lazy(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    bfg_cell_t src,
+    int n,
+    bfg_cell_t pending,
+    bfg_cell_t out
+);
+
+/// dst -= src without normalization, pending counts borrows
+void bfg_int_sub_lazy(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    bfg_cell_t src,
+    int n,
+    bfg_cell_t pending,
+    bfg_cell_t out
+);
+
+/**
+* Folds pending carries (sign > 0) or borrows (sign < 0) into dst and
+* clears them. Carries out of the top byte go to `out` (if given).
+*/
+void bfg_int_flush(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    int n,
+    bfg_cell_t pending,
+    int sign,
+    bfg_cell_t out
+);
+
+/// dst += src (mod 256^n), out += carry out of the top byte (if given)
+void bfg_int_add(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    bfg_cell_t src,
+    int n,
+    bfg_cell_t out
+);
+
+/// bfg_int_add with every carry rippled up as soon as it happens
+void bfg_int_add_eager(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    bfg_cell_t src,
+    int n,
+    bfg_cell_t out
+);
+
+/// dst -= src (mod 256^n), out += borrow out of the top byte (if given)
+void bfg_int_sub(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    bfg_cell_t src,
+    int n,
+    bfg_cell_t out
+);
+
+/**
+* Splits the byte x into q += x / k and r += x % k (1 < k <= 256, q and r
+* must not be x). x is consumed.
+*/
+void bfg_int_divmod_byte(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t x,
+    int k,
+    bfg_cell_t q,
+    bfg_cell_t r
+);
+
+/// x <<= bits (constant)
+void bfg_int_shl(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int n, int bits);
+
+/// x >>= bits (constant, logical)
+void bfg_int_shr(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int n, int bits);
+
+/// x >>= bits (constant, arithmetic)
+void bfg_int_sar(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int n, int bits);
+
+/// Sign-extends the `from`-byte number x to `to` bytes (upper bytes zero)
+void bfg_int_sext(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int from, int to);
+
+/**
+* dst = a * b (mod 256^n) by shift-and-add over the bits of b, which has
+* nb bytes (the bytes above are not looked at, so a 32x32->64 product is
+* n = 8, nb = 4 with zero-extended operands). a and b are consumed.
+*/
+void bfg_int_mul(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    int n,
+    bfg_cell_t a,
+    bfg_cell_t b,
+    int nb
+);
+
+/// bfg_int_mul by repeated addition of a, once per unit of each byte of b
+void bfg_int_mul_school(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    int n,
+    bfg_cell_t a,
+    bfg_cell_t b,
+    int nb
+);
+
+/**
+* 2h x 2h -> 4h byte product (h <= 2) with one Karatsuba step over
+* bfg_int_mul: three half-size products instead of four. `scratch` is the
+* first of three free registers. a and b are consumed.
+*/
+void bfg_int_mul_karatsuba(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    bfg_cell_t a,
+    bfg_cell_t b,
+    int h,
+    bfg_cell_t scratch
+);
+
+/**
+* Unsigned q = a / b, r = a % b by restoring division. Division by zero
+* gives q = all ones, r = a. a and b are consumed.
+*/
+void bfg_int_divmod(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t q,
+    bfg_cell_t r,
+    bfg_cell_t a,
+    bfg_cell_t b,
+    int n
+);
+
+/**
+* switch (x) with the cases lo .. lo + count - 1 (count <= 255, lo taken
+* mod 256^n): x - lo is decoded by bfg_switch, values outside the range go
+* to the default (index count). x is consumed. The cases may use the
+* routines but not x.
+*/
+void bfg_int_switch(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t x,
+    int n,
+    uint64_t lo,
+    int count,
+    bfg_case_fn emit_case,
+    void* ctx
+);
+
+/// flag = a < b (unsigned or two's complement), a and b are preserved
+void bfg_int_lt(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t flag,
+    bfg_cell_t a,
+    bfg_cell_t b,
+    int n,
+    bool is_signed
+);
+
+/// flag = a == b, a and b are preserved
+void bfg_int_eq(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t flag,
+    bfg_cell_t a,
+    bfg_cell_t b,
+    int n
+);
+
+#endif
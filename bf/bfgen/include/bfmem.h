@@ -0,0 +1,89 @@
+#ifndef BFMEM_H__
+#define BFMEM_H__
+
+/**
+* Random-access memory for generated code (the C heap and globals).
+*
+* The heap is a tree of blocks. An address is split into `levels` index
+* bytes; byte k picks one of `fanout` children of a level k+1 block. A
+* dereference lays a trail of marks through the tree and walks it with
+* scan loops, so it costs O(levels * fanout) ops no matter how big the
+* heap is. Layout details are in README.md ("Memory model").
+*
+* With `cached` set, the trails above the leaves stay in place between
+* accesses and are only rebuilt when the page (address without its low
+* byte) changes.
+*/
+
+#include <bfgen.h>
+
+#define BFG_MEM_MAX_LEVELS 4
+
+/// Frame cells used by the memory routines (see bfg_mem_init)
+#define BFG_MEM_FRAME_CELLS (BFG_MEM_MAX_LEVELS + 3)
+
+typedef struct bfg_mem {
+    int levels;
+    int fanout;
+    bool cached;
+    /// Root block; the heap occupies [base, base + block_size[levels])
+    bfg_cell_t base;
+    /// Cached index bytes of the page currently laid out (levels >= 1)
+    bfg_cell_t cache[BFG_MEM_MAX_LEVELS];
+    /// "page changed" flag and two scratch cells
+    bfg_cell_t flag;
+    bfg_cell_t tmp[2];
+    /// Size in cells of a block on every level; block_size[0] is a byte slot
+    long block_size[BFG_MEM_MAX_LEVELS + 1];
+} bfg_mem_t;
+
+/// Every block starts with two trail marks: A (walked rightwards) and B
+/// (walked leftwards). A leaf slot is just the marks and the data cell.
+#define BFG_MEM_MARK_A 0
+#define BFG_MEM_MARK_B 1
+#define BFG_MEM_HEADER_SIZE 2
+#define BFG_MEM_SLOT_DATA 2
+#define BFG_MEM_SLOT_SIZE 3
+
+/**
+* Describes a memory of `fanout`^`levels` bytes rooted at `base`.
+* `frame` is the first of BFG_MEM_FRAME_CELLS zero cells the routines use
+* as scratch; they must lie left of `base`. Returns false if the
+* parameters are out of range.
+*/
+bool bfg_mem_init(
+    bfg_mem_t* mem,
+    int levels,
+    int fanout,
+    bool cached,
+    bfg_cell_t base,
+    bfg_cell_t frame
+);
+
+/// Number of bytes the memory can hold
+unsigned long bfg_mem_capacity(const bfg_mem_t* mem);
+
+/// Absolute tape cell holding the byte at `address`
+bfg_cell_t bfg_mem_cell(const bfg_mem_t* mem, unsigned long address);
+
+/**
+* dst = memory[addr]. addr[0] is the least significant index byte, there
+* are mem->levels of them and each must be below mem->fanout. The address
+* cells are consumed, dst is overwritten.
+*/
+void bfg_mem_load(
+    bfg_t* g,
+    const bfg_mem_t* mem,
+    const bfg_cell_t* addr,
+    bfg_cell_t dst
+);
+
+/// memory[addr] = src. The address cells and src are consumed.
+void bfg_mem_store(
+    bfg_t* g,
+    const bfg_mem_t* mem,
+    const bfg_cell_t* addr,
+    bfg_cell_t src
+);
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef BFREG_H__
+#define BFREG_H__
+
+/**
+* Register allocation within a basic block.
+*
+* Local scalars live in frame cells outside the register area. Reaching one
+* costs a transfer loop per byte, so instead of loading and storing around
+* every statement the allocator keeps the locals a block uses in ALU
+* registers and writes them back once, when the block is left
+* (bfg_regs_flush before any loop, branch or call).
+*
+* Loading a local moves it into its register, leaving the frame cells zero;
+* the flush moves it back. A local that is only written (bfg_regs_def) is
+* not loaded at all: its stale frame cells are cleared at the flush. When
+* all registers are taken the least recently used local is written back.
+*
+* Reading a cell empties it, so a plain copy is two loops: out to the
+* destination and a temporary, then back. bfg_regs_copy() fills every
+* destination of a read in one loop and avoids the way back: a local that
+* is dead afterwards is simply consumed, and a live one is moved into a
+* free register along with the destinations and lives there from then on.
+* Only with every register taken does it restore through BFG_ALU_TMP.
+*/
+
+#include <bfint.h>
+
+#define BFG_REGS_MAX 16
+
+typedef struct bfg_reg_slot {
+    /// First frame cell of the local, BFG_NO_CELL if the register is free
+    bfg_cell_t frame;
+    int n;
+    /// The frame cells still hold the old value (the local was not loaded)
+    bool stale;
+    unsigned long used;
+} bfg_reg_slot_t;
+
+typedef struct bfg_regs {
+    const bfg_alu_t* alu;
+    /// Registers first .. first + count - 1 hold locals
+    int first;
+    int count;
+    unsigned long clock;
+    bfg_reg_slot_t slots[BFG_REGS_MAX];
+    /// Frame transfers emitted (one per local), for the statistics
+    unsigned long loads;
+    unsigned long stores;
+    /// Copies that needed the loop back through BFG_ALU_TMP
+    unsigned long restores;
+} bfg_regs_t;
+
+/**
+* Hands registers first .. first + count - 1 of alu (at or above
+* BFG_ALU_USER, zero) to the allocator. Returns false on a bad range.
+*/
+bool bfg_regs_init(bfg_regs_t* ra, const bfg_alu_t* alu, int first, int count);
+
+/// Register holding the n-byte local at frame, loaded on first use
+bfg_cell_t bfg_regs_use(bfg_t* g, bfg_regs_t* ra, bfg_cell_t frame, int n);
+
+/// Register for a new value of the local, cleared; the old value is not loaded
+bfg_cell_t bfg_regs_def(bfg_t* g, bfg_regs_t* ra, bfg_cell_t frame, int n);
+
+/// The local is dead: its register is cleared and freed without a store
+void bfg_regs_kill(bfg_t* g, bfg_regs_t* ra, bfg_cell_t frame);
+
+/**
+* dst[i] = local for every i < count (registers, n bytes each), in one
+* transfer loop per byte. With dead set the local is not used again and is
+* freed without being restored.
+*/
+void bfg_regs_copy(
+    bfg_t* g,
+    bfg_regs_t* ra,
+    bfg_cell_t frame,
+    int n,
+    const bfg_cell_t* dst,
+    int count,
+    bool dead
+);
+
+/// Block exit: every local goes back to the frame, all registers are free
+void bfg_regs_flush(bfg_t* g, bfg_regs_t* ra);
+
+#endif
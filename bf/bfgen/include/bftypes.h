@@ -0,0 +1,12 @@
+#ifndef BFTYPES_H__
+#define BFTYPES_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vec.h>
+
+typedef long bfg_cell_t;
+
+DECL_VEC(char);
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef BFVM_H__
+#define BFVM_H__
+
+/**
+* bfvm - reference BF interpreter used to check and measure generated code.
+*
+* The program is folded the same way ibf folds it: runs of '+'/'-' and
+* '>'/'<' become a single op, pure scan loops ([>>>], [<<]) become a
+* single scan op and runs of transfer loops [->>+<<]>[->>+<<]... (block
+* moves, bfg_move_block) become a single block op. `ops` counts executed folded ops, `commands` counts the
+* BF commands a naive interpreter would have executed.
+*/
+
+#include <stdbool.h>
+#include <bftypes.h>
+
+typedef enum bfvm_op {
+    BFVM_ADD,
+    BFVM_MOVE,
+    BFVM_OPEN,
+    BFVM_CLOSE,
+    BFVM_SCAN,
+    BFVM_BLOCK,
+    BFVM_WRITE,
+    BFVM_READ
+} bfvm_op_t;
+
+typedef struct bfvm_inst {
+    bfvm_op_t op;
+    long arg;
+    /// Matching bracket for loops, the closing bracket for scans and blocks
+    size_t jump;
+    /// Number of source commands folded into this op
+    long width;
+    /// Cells moved by a block op (arg is the distance)
+    size_t cells;
+} bfvm_inst_t;
+
+DECL_VEC(bfvm_inst_t);
+
+typedef enum bfvm_status {
+    BFVM_OK,
+    BFVM_ERR_SYNTAX,
+    BFVM_ERR_TAPE,
+    BFVM_ERR_LIMIT,
+    BFVM_ERR_MEMORY
+} bfvm_status_t;
+
+typedef struct bfvm_stats {
+    uint64_t ops;
+    uint64_t commands;
+} bfvm_stats_t;
+
+typedef struct bfvm {
+    VEC_TYPE(bfvm_inst_t) program;
+    uint8_t* tape;
+    size_t tape_size;
+    size_t dp;
+    const char* input;
+    VEC_TYPE(char) output;
+    bfvm_stats_t stats;
+} bfvm_t;
+
+/// Allocates a zeroed tape of tape_size cells
+bool bfvm_init(bfvm_t* vm, size_t tape_size);
+void bfvm_free(bfvm_t* vm);
+
+/// Parses and folds the program, resets the tape and the statistics
+bfvm_status_t bfvm_load(bfvm_t* vm, const char* code);
+
+/// Runs the loaded program; max_ops == 0 means no limit
+bfvm_status_t bfvm_run(bfvm_t* vm, uint64_t max_ops);
+
+/// Output produced so far as a C string
+const char* bfvm_output(bfvm_t* vm);
+
+const char* bfvm_status_name(bfvm_status_t status);
+
+#endif
@@ -0,0 +1,324 @@
+#include <bfgen.h>
+#include <string.h>
+
+void bfg_init(bfg_t* g) {
+    VEC_TYPE(char) code = VEC_INIT();
+    VEC_TYPE(bfg_loop_frame_t) loops = VEC_INIT();
+    VEC_TYPE(bfg_map_entry_t) map = VEC_INIT();
+
+    g->code = code;
+    g->loops = loops;
+    g->map = map;
+    g->head = 0;
+    g->anchor = BFG_STATIC_ANCHOR;
+    g->anchors = 0;
+    g->error = NULL;
+}
+
+void bfg_free(bfg_t* g) {
+    VEC_FREE(g->code);
+    VEC_FREE(g->loops);
+    VEC_FREE(g->map);
+}
+
+const char* bfg_code(bfg_t* g) {
+    bool res;
+
+    // keep the buffer NUL-terminated without counting the terminator
+    VEC_PUSH(g->code, 0, res);
+    if (!res) {
+        bfg_fail(g, "out of memory");
+        return "";
+    }
+    g->code.length--;
+    return g->code.data;
+}
+
+void bfg_fail(bfg_t* g, const char* error) {
+    if (g->error == NULL)
+        g->error = error;
+}
+
+void bfg_put(bfg_t* g, char c, long n) {
+    bool res = true;
+
+    if (n <= 0)
+        return;
+    size_t needed = g->code.length + (size_t) n + 1;
+    if (needed > g->code.capacity) {
+        size_t capacity = g->code.capacity * 2;
+        VEC_RESERVE(g->code, capacity > needed ? capacity : needed, res);
+        if (!res) {
+            bfg_fail(g, "out of memory");
+            return;
+        }
+    }
+    memset(g->code.data + g->code.length, c, (size_t) n);
+    g->code.length += (size_t) n;
+}
+
+void bfg_comment(bfg_t* g, const char* text) {
+    bfg_put(g, '\n', 1);
+    for (; *text; text++) {
+        switch (*text) {
+            case '+': case '-': case '<': case '>':
+            case '[': case ']': case '.': case ',':
+            case '#':
+                bfg_put(g, ' ', 1);
+                break;
+            default:
+                bfg_put(g, *text, 1);
+                break;
+        }
+    }
+    bfg_put(g, '\n', 1);
+}
+
+void bfg_locate(bfg_t* g, const char* file, int line, const char* function) {
+    bfg_map_entry_t entry = {
+        .start = g->code.length, .file = file, .line = line, .function = function
+    };
+    bool res;
+
+    if (g->map.length > 0) {
+        bfg_map_entry_t* open = &g->map.data[g->map.length - 1];
+
+        if (open->line == line && strcmp(open->file, file) == 0
+            && strcmp(open->function, function) == 0)
+            return;
+        open->end = g->code.length;
+        // nothing was emitted for it
+        if (open->start == open->end)
+            g->map.length--;
+    }
+    VEC_PUSH(g->map, entry, res);
+    if (!res)
+        bfg_fail(g, "out of memory");
+}
+
+bool bfg_write_map(bfg_t* g, FILE* f) {
+    if (g->map.length > 0)
+        g->map.data[g->map.length - 1].end = g->code.length;
+    fprintf(f, "# bfmap 1\n");
+    for (size_t i = 0; i < g->map.length; i++) {
+        const bfg_map_entry_t* e = &g->map.data[i];
+
+        if (e->start < e->end)
+            fprintf(f, "%zu %zu %s:%d %s\n", e->start, e->end, e->file, e->line, e->function);
+    }
+    return !ferror(f);
+}
+
+void bfg_move_rel(bfg_t* g, long delta) {
+    if (delta > 0)
+        bfg_put(g, '>', delta);
+    else
+        bfg_put(g, '<', -delta);
+    g->head += delta;
+}
+
+void bfg_goto(bfg_t* g, bfg_cell_t cell) {
+    if (g->anchor != BFG_STATIC_ANCHOR) {
+        bfg_fail(g, "goto from a dynamic head position");
+        return;
+    }
+    bfg_move_rel(g, cell - g->head);
+}
+
+void bfg_rebase(bfg_t* g, bfg_cell_t cell) {
+    g->anchor = BFG_STATIC_ANCHOR;
+    g->head = cell;
+}
+
+int bfg_new_anchor(bfg_t* g) {
+    return ++g->anchors;
+}
+
+void bfg_set_anchor(bfg_t* g, int anchor, long offset) {
+    g->anchor = anchor;
+    g->head = offset;
+}
+
+void bfg_glide(bfg_t* g, long stride) {
+    bfg_put(g, '[', 1);
+    bfg_put(g, stride > 0 ? '>' : '<', stride > 0 ? stride : -stride);
+    bfg_put(g, ']', 1);
+    bfg_set_anchor(g, bfg_new_anchor(g), 0);
+}
+
+void bfg_glide_clear(bfg_t* g, long stride) {
+    bfg_put(g, '[', 1);
+    bfg_put(g, '-', 1);
+    bfg_put(g, stride > 0 ? '>' : '<', stride > 0 ? stride : -stride);
+    bfg_put(g, ']', 1);
+    bfg_set_anchor(g, bfg_new_anchor(g), 0);
+}
+
+void bfg_loop(bfg_t* g) {
+    bfg_loop_frame_t frame = { .anchor = g->anchor, .head = g->head };
+    bool res;
+
+    VEC_PUSH(g->loops, frame, res);
+    if (!res)
+        bfg_fail(g, "out of memory");
+    bfg_put(g, '[', 1);
+}
+
+void bfg_end(bfg_t* g) {
+    bfg_loop_frame_t frame;
+    bool res;
+
+    VEC_POP(g->loops, frame, res);
+    if (!res) {
+        bfg_fail(g, "unmatched loop end");
+        return;
+    }
+    if (frame.anchor != g->anchor || frame.head != g->head)
+        bfg_fail(g, "unbalanced loop");
+    bfg_put(g, ']', 1);
+}
+
+void bfg_while(bfg_t* g, bfg_cell_t cell) {
+    bfg_goto(g, cell);
+    bfg_loop(g);
+}
+
+void bfg_end_at(bfg_t* g, bfg_cell_t cell) {
+    bfg_goto(g, cell);
+    bfg_end(g);
+}
+
+void bfg_if_zero(bfg_t* g, bfg_cell_t cell, bfg_cell_t flag) {
+    long d = flag - cell;
+
+    if (d == 0) {
+        bfg_fail(g, "zero test flag overlaps the cell");
+        return;
+    }
+    bfg_add(g, flag, 1);
+    // nonzero: step onto the flag, clear it and stop there; zero: stay
+    bfg_goto(g, cell);
+    bfg_put(g, '[', 1);
+    bfg_move_rel(g, d);
+    bfg_add_here(g, -1);
+    bfg_put(g, ']', 1);
+    // now one more step lands on the flag (1) or on the zero after it
+    bfg_rebase(g, cell);
+    bfg_move_rel(g, d);
+    bfg_loop(g);
+    bfg_add_here(g, -1);
+}
+
+void bfg_end_if_zero(bfg_t* g, bfg_cell_t cell, bfg_cell_t flag) {
+    bfg_goto(g, flag);
+    bfg_move_rel(g, flag - cell);
+    // the loop is left one cell further on purpose
+    bfg_rebase(g, flag);
+    bfg_end(g);
+    bfg_rebase(g, flag + (flag - cell));
+}
+
+void bfg_switch(
+    bfg_t* g,
+    bfg_cell_t value,
+    bfg_cell_t flag,
+    int count,
+    bfg_case_fn emit_case,
+    void* ctx
+) {
+    if (count < 1 || count > 255 || value == flag) {
+        bfg_fail(g, "bad switch");
+        return;
+    }
+    bfg_add(g, flag, 1);
+    // level k is entered when the value is above k
+    for (int k = 0; k + 1 < count; k++) {
+        bfg_while(g, value);
+        bfg_add_here(g, -1);
+    }
+    // above the last case: default
+    bfg_while(g, value);
+    bfg_clear_here(g);
+    bfg_add(g, flag, -1);
+    emit_case(g, count, ctx);
+    bfg_end_at(g, value);
+    for (int k = count - 1; k >= 0; k--) {
+        // no deeper level took the flag: the value was exactly k
+        bfg_while(g, flag);
+        bfg_add_here(g, -1);
+        emit_case(g, k, ctx);
+        bfg_end_at(g, flag);
+        if (k > 0)
+            bfg_end_at(g, value);
+    }
+}
+
+void bfg_add_here(bfg_t* g, int delta) {
+    delta &= 0xff;
+    if (delta < 128)
+        bfg_put(g, '+', delta);
+    else
+        bfg_put(g, '-', 256 - delta);
+}
+
+void bfg_add(bfg_t* g, bfg_cell_t cell, int delta) {
+    if ((delta & 0xff) == 0)
+        return;
+    bfg_goto(g, cell);
+    bfg_add_here(g, delta);
+}
+
+void bfg_clear_here(bfg_t* g) {
+    bfg_put(g, '[', 1);
+    bfg_put(g, '-', 1);
+    bfg_put(g, ']', 1);
+}
+
+void bfg_clear(bfg_t* g, bfg_cell_t cell) {
+    bfg_goto(g, cell);
+    bfg_clear_here(g);
+}
+
+void bfg_set(bfg_t* g, bfg_cell_t cell, int value) {
+    bfg_clear(g, cell);
+    bfg_add(g, cell, value);
+}
+
+void bfg_transfer(
+    bfg_t* g,
+    bfg_cell_t src,
+    size_t n,
+    const bfg_cell_t* dst,
+    const int* mul
+) {
+    bfg_while(g, src);
+    bfg_add_here(g, -1);
+    for (size_t i = 0; i < n; i++)
+        bfg_add(g, dst[i], mul ? mul[i] : 1);
+    bfg_end_at(g, src);
+}
+
+void bfg_move(bfg_t* g, bfg_cell_t src, bfg_cell_t dst) {
+    bfg_transfer(g, src, 1, &dst, NULL);
+}
+
+void bfg_move_block(bfg_t* g, bfg_cell_t src, bfg_cell_t dst, long n) {
+    if (src == dst) {
+        bfg_fail(g, "block move onto itself");
+        return;
+    }
+    for (long i = 0; i < n; i++)
+        bfg_move(g, src + i, dst + i);
+}
+
+void bfg_copy(bfg_t* g, bfg_cell_t src, bfg_cell_t dst, bfg_cell_t tmp) {
+    bfg_cell_t both[2] = { dst, tmp };
+
+    bfg_transfer(g, src, 2, both, NULL);
+    bfg_move(g, tmp, src);
+}
+
+void bfg_output(bfg_t* g, bfg_cell_t cell) {
+    bfg_goto(g, cell);
+    bfg_put(g, '.', 1);
+}
@@ -0,0 +1,60 @@
+#include <bfgen_run.h>
+#include <string.h>
+
+#if defined(__GNUC__)
+
+#define IBF_LIBRARY
+#include "../../industrial-bf/evaluator/main.c"
+
+#ifdef _WIN32
+#include <direct.h>
+#define chdir _chdir
+#define getcwd _getcwd
+#endif
+
+bool bfg_run(const char* code, const char* dir) {
+    char cwd[4096];
+    int ret;
+
+    /* ibf reads the tape pages from the current directory */
+    if (dir != NULL && (getcwd(cwd, sizeof(cwd)) == NULL || chdir(dir) != 0)) {
+        fprintf(stderr, "cannot run in %s\n", dir);
+        return false;
+    }
+    ret = ibf_run(code, strlen(code));
+    if (dir != NULL && chdir(cwd) != 0) {
+        fprintf(stderr, "cannot go back to %s\n", cwd);
+        return false;
+    }
+    return ret == 0;
+}
+
+#else
+
+#include <bfvm.h>
+#include <stdio.h>
+
+/// Enough for the tree memory with 3 levels of 256 (about 50 M cells)
+#define RUN_TAPE_SIZE (64ul << 20)
+
+bool bfg_run(const char* code, const char* dir) {
+    bfvm_status_t status;
+    bfvm_t vm;
+
+    if (dir != NULL) {
+        fprintf(stderr, "tape images need ibf, which this build does not have\n");
+        return false;
+    }
+    if (!bfvm_init(&vm, RUN_TAPE_SIZE))
+        return false;
+    status = bfvm_load(&vm, code);
+    if (status == BFVM_OK)
+        status = bfvm_run(&vm, 0);
+    fputs(bfvm_output(&vm), stdout);
+    if (status != BFVM_OK)
+        fprintf(stderr, "%s\n", bfvm_status_name(status));
+    bfvm_free(&vm);
+    return status == BFVM_OK;
+}
+
+#endif
@@ -0,0 +1,400 @@
+#include <bfgen.h>
+#include <bfgen_run.h>
+#include <bfgen_tests.h>
+#include <bfimage.h>
+#include <bfmem.h>
+#include <bfvm.h>
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_TAPE_SIZE 0x100000
+
+static uint32_t test_random_state = 12345;
+
+static uint32_t test_random(void) {
+    test_random_state = test_random_state * 1103515245u + 12345u;
+    return test_random_state >> 8;
+}
+
+/// Runs the generated code and leaves the VM alive for inspection
+static void run_generated(bfg_t* g, bfvm_t* vm) {
+    bool res;
+    assert(g->error == NULL);
+    assert(g->loops.length == 0);
+    res = bfvm_init(vm, TEST_TAPE_SIZE);
+    assert(res);
+    res = bfvm_load(vm, bfg_code(g)) == BFVM_OK;
+    assert(res);
+    res = bfvm_run(vm, 0) == BFVM_OK;
+    assert(res);
+}
+
+void test_bfg_basic_ops(void) {
+    printf("Running test_bfg_basic_ops... ");
+    bfg_t g;
+    bfvm_t vm;
+
+    bfg_init(&g);
+    bfg_set(&g, 3, 200);
+    bfg_copy(&g, 3, 5, 6);
+    bfg_add(&g, 5, 100);
+    bfg_move(&g, 3, 7);
+    bfg_output(&g, 5);
+    run_generated(&g, &vm);
+
+    assert(vm.tape[3] == 0);
+    assert(vm.tape[5] == 44);
+    assert(vm.tape[6] == 0);
+    assert(vm.tape[7] == 200);
+    assert(strcmp(bfvm_output(&vm), ",") == 0);
+
+    bfvm_free(&vm);
+    bfg_free(&g);
+    printf("OK\n");
+}
+
+void test_bfg_unbalanced_loop(void) {
+    printf("Running test_bfg_unbalanced_loop... ");
+    bfg_t g;
+
+    bfg_init(&g);
+    bfg_while(&g, 1);
+    bfg_goto(&g, 2);
+    bfg_end(&g);
+    assert(g.error != NULL);
+    bfg_free(&g);
+    printf("OK\n");
+}
+
+void test_bfvm_folding(void) {
+    bool res;
+    printf("Running test_bfvm_folding... ");
+    bfvm_t vm;
+
+    res = bfvm_init(&vm, 64);
+    assert(res);
+    res = bfvm_load(&vm, "+>+>+>+>>>>+<<<<<<<[>]") == BFVM_OK;
+    assert(res);
+    res = bfvm_run(&vm, 0) == BFVM_OK;
+    assert(res);
+    assert(vm.dp == 4);
+    // +>+>+>+ then >>>>, +, <<<<<<< and the scan
+    assert(vm.stats.ops == 11);
+    res = bfvm_load(&vm, "[") == BFVM_ERR_SYNTAX;
+    assert(res);
+    res = bfvm_load(&vm, "<") == BFVM_OK;
+    assert(res);
+    res = bfvm_run(&vm, 0) == BFVM_ERR_TAPE;
+    assert(res);
+    bfvm_free(&vm);
+    printf("OK\n");
+}
+
+/*
+* Stores random bytes at random addresses, reads them back in another
+* order and checks the output, the tape image and that no trail marks are
+* left behind (except the cached page in cached mode).
+*/
+static void check_mem(int levels, int fanout, bool cached) {
+    bool res;
+    enum { FRAME = 0, ADDR = BFG_MEM_FRAME_CELLS, BASE = ADDR + BFG_MEM_MAX_LEVELS + 4 };
+    enum { PAIRS = 12 };
+    bfg_cell_t addr[BFG_MEM_MAX_LEVELS];
+    bfg_cell_t value = ADDR + BFG_MEM_MAX_LEVELS;
+    unsigned long addresses[PAIRS];
+    uint8_t values[PAIRS];
+    char expected[PAIRS + 1];
+    bfg_mem_t mem;
+    bfg_t g;
+    bfvm_t vm;
+
+    res = bfg_mem_init(&mem, levels, fanout, cached, BASE, FRAME);
+    assert(res);
+    assert(BASE + mem.block_size[levels] < TEST_TAPE_SIZE);
+    for (int k = 0; k < levels; k++)
+        addr[k] = ADDR + k;
+
+    for (int i = 0; i < PAIRS; i++) {
+        addresses[i] = test_random() % bfg_mem_capacity(&mem);
+        // the first and the last slot of the memory
+        if (i == 0)
+            addresses[i] = 0;
+        if (i == PAIRS - 1)
+            addresses[i] = bfg_mem_capacity(&mem) - 1;
+        values[i] = (uint8_t) ('A' + test_random() % 26);
+        for (int j = 0; j < i; j++) {
+            if (addresses[j] == addresses[i])
+                values[j] = values[i];
+        }
+    }
+
+    bfg_init(&g);
+    for (int i = 0; i < PAIRS; i++) {
+        unsigned long a = addresses[i];
+        for (int k = 0; k < levels; k++) {
+            bfg_set(&g, addr[k], (int) (a % (unsigned long) fanout));
+            a /= (unsigned long) fanout;
+        }
+        bfg_set(&g, value, values[i]);
+        bfg_mem_store(&g, &mem, addr, value);
+    }
+    for (int i = PAIRS - 1; i >= 0; i--) {
+        unsigned long a = addresses[i];
+        for (int k = 0; k < levels; k++) {
+            bfg_set(&g, addr[k], (int) (a % (unsigned long) fanout));
+            a /= (unsigned long) fanout;
+        }
+        bfg_mem_load(&g, &mem, addr, value);
+        bfg_output(&g, value);
+        expected[PAIRS - 1 - i] = (char) values[i];
+    }
+    expected[PAIRS] = 0;
+    run_generated(&g, &vm);
+
+    assert(strcmp(bfvm_output(&vm), expected) == 0);
+    for (int i = 0; i < PAIRS; i++)
+        assert(vm.tape[bfg_mem_cell(&mem, addresses[i])] == values[i]);
+    if (!cached) {
+        for (long cell = BASE; cell < BASE + mem.block_size[levels]; cell++) {
+            bool data = false;
+            for (int i = 0; i < PAIRS; i++)
+                data = data || cell == bfg_mem_cell(&mem, addresses[i]);
+            assert(data || vm.tape[cell] == 0);
+        }
+    }
+    for (int k = 0; k < levels; k++)
+        assert(vm.tape[addr[k]] == 0);
+    assert(vm.tape[mem.flag] == 0 && vm.tape[mem.tmp[0]] == 0 && vm.tape[mem.tmp[1]] == 0);
+
+    bfvm_free(&vm);
+    bfg_free(&g);
+}
+
+void test_bfg_mem_flat(void) {
+    printf("Running test_bfg_mem_flat... ");
+    check_mem(1, 200, false);
+    printf("OK\n");
+}
+
+void test_bfg_mem_tree(void) {
+    printf("Running test_bfg_mem_tree... ");
+    check_mem(2, 16, false);
+    check_mem(3, 6, false);
+    printf("OK\n");
+}
+
+void test_bfg_mem_cached(void) {
+    printf("Running test_bfg_mem_cached... ");
+    check_mem(2, 16, true);
+    check_mem(3, 5, true);
+    printf("OK\n");
+}
+
+void test_bfg_mem_layout(void) {
+    bool res;
+    printf("Running test_bfg_mem_layout... ");
+    bfg_mem_t mem;
+
+    res = bfg_mem_init(&mem, 2, 4, false, 10, 0);
+    assert(res);
+    assert(mem.block_size[1] == 2 + 4 * 3);
+    assert(mem.block_size[2] == 2 + 4 * 14);
+    assert(bfg_mem_cell(&mem, 0) == 10 + 2 + 2 + 2);
+    assert(bfg_mem_cell(&mem, 5) == 10 + 2 + 14 + 2 + 3 + 2);
+    res = bfg_mem_init(&mem, 2, 4, false, 3, 0);
+    assert(!res);
+    res = bfg_mem_init(&mem, 0, 4, false, 10, 0);
+    assert(!res);
+    res = bfg_mem_init(&mem, 2, 257, false, 10, 0);
+    assert(!res);
+    printf("OK\n");
+}
+
+void test_bfg_source_map(void) {
+    bool res;
+    printf("Running test_bfg_source_map... ");
+    char text[256];
+    bfg_t g;
+
+    bfg_init(&g);
+    bfg_locate(&g, "a.c", 1, "f");
+    bfg_set(&g, 1, 3);
+    bfg_locate(&g, "a.c", 1, "f");
+    bfg_add(&g, 1, 1);
+    bfg_locate(&g, "a.c", 2, "f");
+    bfg_locate(&g, "b.c", 7, "g");
+    bfg_output(&g, 1);
+
+    FILE* f = tmpfile();
+    assert(f != NULL);
+    res = bfg_write_map(&g, f);
+    assert(res);
+    rewind(f);
+    size_t n = fread(text, 1, sizeof(text) - 1, f);
+    text[n] = 0;
+    fclose(f);
+    // ">[-]+++" and "+" share a line, a.c:2 got no code
+    assert(strcmp(text, "# bfmap 1\n0 8 a.c:1 f\n8 9 b.c:7 g\n") == 0);
+    assert(strcmp(bfg_code(&g), ">[-]++++.") == 0);
+    bfg_free(&g);
+    printf("OK\n");
+}
+
+void test_bfg_image(void) {
+    bool res;
+    printf("Running test_bfg_image... ");
+    enum { FRAME = 0, ADDR = BFG_MEM_FRAME_CELLS, VALUE = ADDR + 2, BASE = VALUE + 1 };
+    static const char table[] = "finesine";
+    bfg_cell_t addr[2] = { ADDR, ADDR + 1 };
+    bfg_image_t image;
+    bfg_mem_t mem;
+    bfg_t g;
+    bfvm_t vm;
+
+    res = bfg_mem_init(&mem, 2, 16, false, BASE, FRAME);
+    assert(res);
+    bfg_image_init(&image);
+    res = bfg_image_preload(&image, &mem, 100, table, sizeof(table) - 1);
+    assert(res);
+    res = bfg_image_preload(&image, &mem, 250, table, sizeof(table) - 1);
+    assert(!res);
+    assert(bfg_image_get(&image, bfg_mem_cell(&mem, 101)) == 'i');
+    assert(bfg_image_get(&image, TEST_TAPE_SIZE) == 0);
+
+    // the program only reads the table: it is in the tape from the start
+    bfg_init(&g);
+    for (unsigned long a = 100; a < 100 + sizeof(table) - 1; a++) {
+        bfg_set(&g, addr[0], (int) (a % 16));
+        bfg_set(&g, addr[1], (int) (a / 16));
+        bfg_mem_load(&g, &mem, addr, VALUE);
+        bfg_output(&g, VALUE);
+    }
+    assert(g.error == NULL);
+    res = bfvm_init(&vm, TEST_TAPE_SIZE);
+    assert(res);
+    res = bfvm_load(&vm, bfg_code(&g)) == BFVM_OK;
+    assert(res);
+    memcpy(vm.tape, image.cells.data, image.cells.length);
+    res = bfvm_run(&vm, 0) == BFVM_OK;
+    assert(res);
+    assert(strcmp(bfvm_output(&vm), table) == 0);
+
+    bfvm_free(&vm);
+    bfg_free(&g);
+    bfg_image_free(&image);
+    printf("OK\n");
+}
+
+/// Case body of the switch tests: *cell = index + 1
+static void set_case(bfg_t* g, int index, void* ctx) {
+    bfg_set(g, *(bfg_cell_t*) ctx, index + 1);
+}
+
+void test_bfg_switch(void) {
+    printf("Running test_bfg_switch... ");
+    bfg_cell_t out = 5;
+
+    for (int value = 0; value < 9; value++) {
+        bfg_t g;
+        bfvm_t vm;
+
+        bfg_init(&g);
+        bfg_set(&g, 1, value);
+        bfg_switch(&g, 1, 3, 6, set_case, &out);
+        run_generated(&g, &vm);
+        assert(vm.tape[out] == (value < 6 ? value : 6) + 1);
+        assert(vm.tape[1] == 0 && vm.tape[3] == 0);
+        bfvm_free(&vm);
+        bfg_free(&g);
+    }
+    printf("OK\n");
+}
+
+/// Case body of the nested switch test: *cell = last digit of the index
+static void set_digit_case(bfg_t* g, int index, void* ctx) {
+    bfg_set(g, *(bfg_cell_t*) ctx, '0' + index % 10);
+}
+
+void test_bfg_switch_nested(void) {
+    bool res;
+    printf("Running test_bfg_switch_nested... ");
+    enum { VALUE = 1, COUNTER = 2, FLAG = 3, TMP = 4 };
+    bfg_cell_t out = 5;
+    bfg_t g;
+    bfvm_t vm;
+
+    // the largest switch inside a loop nests 257 loops deep, the case
+    // bodies one more: over what a byte-sized loop stack holds
+    bfg_init(&g);
+    bfg_set(&g, COUNTER, 3);
+    bfg_while(&g, COUNTER);
+    bfg_copy(&g, COUNTER, VALUE, TMP);
+    bfg_add(&g, VALUE, 252);
+    bfg_switch(&g, VALUE, FLAG, 255, set_digit_case, &out);
+    bfg_output(&g, out);
+    bfg_add(&g, COUNTER, -1);
+    bfg_end_at(&g, COUNTER);
+    run_generated(&g, &vm);
+    // 255 is the default, then the cases 254 and 253
+    assert(strcmp(bfvm_output(&vm), "543") == 0);
+    bfvm_free(&vm);
+
+    // the same code through ibf's evaluator (bfvm where ibf is not built)
+    res = bfg_run(bfg_code(&g), NULL);
+    assert(res);
+    bfg_free(&g);
+    printf(" OK\n");
+}
+
+void test_bfg_move_block(void) {
+    printf("Running test_bfg_move_block... ");
+    enum { SRC = 20, N = 9 };
+    static const bfg_cell_t dsts[] = { 40, 3, 17 };
+
+    // away to the right, to the left, and overlapping with dst < src
+    for (size_t k = 0; k < sizeof(dsts) / sizeof(dsts[0]); k++) {
+        uint8_t expected[64] = { 0 };
+        size_t blocks = 0;
+        bfg_t g;
+        bfvm_t vm;
+
+        bfg_init(&g);
+        for (int i = 0; i < N; i++) {
+            expected[SRC + i] = (uint8_t) (test_random() % 200 + 1);
+            bfg_set(&g, SRC + i, expected[SRC + i]);
+        }
+        for (int i = 0; i < N; i++) {
+            expected[dsts[k] + i] += expected[SRC + i];
+            expected[SRC + i] = 0;
+        }
+        bfg_move_block(&g, SRC, dsts[k], N);
+        run_generated(&g, &vm);
+
+        for (size_t i = 0; i < vm.program.length; i++)
+            blocks += vm.program.data[i].op == BFVM_BLOCK;
+        assert(blocks == 1);
+        assert(vm.dp == SRC + N - 1);
+        assert(memcmp(vm.tape, expected, sizeof(expected)) == 0);
+        bfvm_free(&vm);
+        bfg_free(&g);
+    }
+    printf("OK\n");
+}
+
+void run_bfgen_tests(void) {
+    printf("testing bfgen...\n");
+    test_bfg_basic_ops();
+    test_bfg_unbalanced_loop();
+    test_bfvm_folding();
+    test_bfg_mem_layout();
+    test_bfg_mem_flat();
+    test_bfg_mem_tree();
+    test_bfg_mem_cached();
+    test_bfg_source_map();
+    test_bfg_switch();
+    test_bfg_switch_nested();
+    test_bfg_image();
+    test_bfg_move_block();
+    printf("All bfgen tests passed!\n");
+}
@@ -0,0 +1,79 @@
+#include <bfimage.h>
+#include <stdio.h>
+
+void bfg_image_init(bfg_image_t* image) {
+    image->cells = (VEC_TYPE(char)) VEC_INIT();
+}
+
+void bfg_image_free(bfg_image_t* image) {
+    VEC_FREE(image->cells);
+}
+
+bool bfg_image_set(bfg_image_t* image, bfg_cell_t cell, uint8_t value) {
+    bool res = true;
+
+    if (cell < 0)
+        return false;
+    if ((size_t) cell >= image->cells.length) {
+        if (value == 0)
+            return true;
+        size_t capacity = image->cells.capacity ? image->cells.capacity : 0x1000;
+        while (capacity <= (size_t) cell)
+            capacity *= 2;
+        VEC_RESERVE(image->cells, capacity, res);
+        if (!res)
+            return false;
+        memset(image->cells.data + image->cells.length, 0, (size_t) cell + 1 - image->cells.length);
+        image->cells.length = (size_t) cell + 1;
+    }
+    image->cells.data[cell] = (char) value;
+    return true;
+}
+
+uint8_t bfg_image_get(const bfg_image_t* image, bfg_cell_t cell) {
+    if (cell < 0 || (size_t) cell >= image->cells.length)
+        return 0;
+    return (uint8_t) image->cells.data[cell];
+}
+
+bool bfg_image_preload(
+    bfg_image_t* image,
+    const bfg_mem_t* mem,
+    unsigned long address,
+    const void* data,
+    size_t n
+) {
+    const uint8_t* bytes = data;
+
+    if (address > bfg_mem_capacity(mem) || n > bfg_mem_capacity(mem) - address)
+        return false;
+    for (size_t i = 0; i < n; i++) {
+        if (!bfg_image_set(image, bfg_mem_cell(mem, address + i), bytes[i]))
+            return false;
+    }
+    return true;
+}
+
+bool bfg_image_write(const bfg_image_t* image, const char* dir) {
+    size_t length = image->cells.length;
+    char filename[4096];
+
+    for (size_t start = 0; start < length; start += BFG_IMAGE_PAGE_SIZE) {
+        size_t end = length - start < BFG_IMAGE_PAGE_SIZE ? length : start + BFG_IMAGE_PAGE_SIZE;
+
+        while (end > start && image->cells.data[end - 1] == 0)
+            end--;
+        if (end == start)
+            continue;
+
+        snprintf(filename, sizeof(filename), "%s/%016lx", dir,
+            (unsigned long) (start / BFG_IMAGE_PAGE_SIZE));
+        FILE* f = fopen(filename, "wb");
+        if (f == NULL)
+            return false;
+        bool ok = fwrite(image->cells.data + start, 1, end - start, f) == end - start;
+        if (fclose(f) != 0 || !ok)
+            return false;
+    }
+    return true;
+}
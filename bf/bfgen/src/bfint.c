@@ -0,0 +1,643 @@
+#include <bfint.h>
+
+bool bfg_alu_init(bfg_alu_t* alu, bfg_cell_t base, int registers, int width) {
+    if (base < 0 || registers < BFG_ALU_USER)
+        return false;
+    if (width < 1 || width > BFG_ALU_MAX_WIDTH)
+        return false;
+
+    alu->base = base;
+    alu->registers = registers;
+    alu->width = width;
+    alu->span = (long) registers * width;
+    return true;
+}
+
+bfg_cell_t bfg_alu_reg(const bfg_alu_t* alu, int r) {
+    return alu->base + (long) r * alu->width;
+}
+
+long bfg_alu_cells(const bfg_alu_t* alu) {
+    return 3 * alu->span;
+}
+
+static bool int_check(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int n) {
+    if (n < 1 || n > alu->width || x < alu->base || x + n > alu->base + alu->span) {
+        bfg_fail(g, "operand outside the register area");
+        return false;
+    }
+    return true;
+}
+
+static bfg_cell_t int_byte(const bfg_alu_t* alu, int i) {
+    return bfg_alu_reg(alu, BFG_ALU_BYTE) + i;
+}
+
+static void int_if_zero(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x) {
+    bfg_if_zero(g, x, x + alu->span);
+}
+
+static void int_end_if_zero(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x) {
+    bfg_end_if_zero(g, x, x + alu->span);
+}
+
+/// Cell that takes the carry out of byte i: the next pending counter or `out`
+static bfg_cell_t int_carry_cell(int i, int n, bfg_cell_t pending, bfg_cell_t out) {
+    return i + 1 < n ? pending + i + 1 : out;
+}
+
+void bfg_int_clear(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int n) {
+    if (!int_check(g, alu, x, n))
+        return;
+    for (int i = 0; i < n; i++)
+        bfg_clear(g, x + i);
+}
+
+void bfg_int_set(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int n, uint64_t value) {
+    if (!int_check(g, alu, x, n))
+        return;
+    for (int i = 0; i < n; i++) {
+        bfg_set(g, x + i, (int) (value & 0xff));
+        value >>= 8;
+    }
+}
+
+void bfg_int_move(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t dst, bfg_cell_t src, int n) {
+    if (dst == src || !int_check(g, alu, dst, n) || !int_check(g, alu, src, n))
+        return;
+    for (int i = 0; i < n; i++) {
+        bfg_clear(g, dst + i);
+        bfg_move(g, src + i, dst + i);
+    }
+}
+
+void bfg_int_copy(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t dst, bfg_cell_t src, int n) {
+    bfg_cell_t tmp = bfg_alu_reg(alu, BFG_ALU_TMP);
+
+    if (dst == src || !int_check(g, alu, dst, n) || !int_check(g, alu, src, n))
+        return;
+    for (int i = 0; i < n; i++) {
+        bfg_clear(g, dst + i);
+        bfg_copy(g, src + i, dst + i, tmp + i);
+    }
+}
+
+void bfg_int_add_lazy(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    bfg_cell_t src,
+    int n,
+    bfg_cell_t pending,
+    bfg_cell_t out
+) {
+    if (!int_check(g, alu, dst, n) || !int_check(g, alu, src, n))
+        return;
+    for (int i = 0; i < n; i++) {
+        bfg_cell_t carry = int_carry_cell(i, n, pending, out);
+
+        bfg_while(g, src + i);
+        bfg_add_here(g, -1);
+        bfg_add(g, dst + i, 1);
+        if (carry != BFG_NO_CELL) {
+            int_if_zero(g, alu, dst + i);
+            bfg_add(g, carry, 1);
+            int_end_if_zero(g, alu, dst + i);
+        }
+        bfg_end_at(g, src + i);
+    }
+}
+
+void bfg_int_sub_lazy(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    bfg_cell_t src,
+    int n,
+    bfg_cell_t pending,
+    bfg_cell_t out
+) {
+    if (!int_check(g, alu, dst, n) || !int_check(g, alu, src, n))
+        return;
+    for (int i = 0; i < n; i++) {
+        bfg_cell_t borrow = int_carry_cell(i, n, pending, out);
+
+        bfg_while(g, src + i);
+        bfg_add_here(g, -1);
+        if (borrow != BFG_NO_CELL) {
+            int_if_zero(g, alu, dst + i);
+            bfg_add(g, borrow, 1);
+            int_end_if_zero(g, alu, dst + i);
+        }
+        bfg_add(g, dst + i, -1);
+        bfg_end_at(g, src + i);
+    }
+}
+
+void bfg_int_flush(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    int n,
+    bfg_cell_t pending,
+    int sign,
+    bfg_cell_t out
+) {
+    if (!int_check(g, alu, dst, n))
+        return;
+    // a carry into byte i can only push pending[i + 1], so one pass upwards is enough
+    for (int i = 1; i < n; i++) {
+        bfg_cell_t carry = int_carry_cell(i, n, pending, out);
+
+        bfg_while(g, pending + i);
+        bfg_add_here(g, -1);
+        if (sign > 0)
+            bfg_add(g, dst + i, 1);
+        if (carry != BFG_NO_CELL) {
+            int_if_zero(g, alu, dst + i);
+            bfg_add(g, carry, 1);
+            int_end_if_zero(g, alu, dst + i);
+        }
+        if (sign < 0)
+            bfg_add(g, dst + i, -1);
+        bfg_end_at(g, pending + i);
+    }
+}
+
+void bfg_int_add(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    bfg_cell_t src,
+    int n,
+    bfg_cell_t out
+) {
+    bfg_cell_t carry = bfg_alu_reg(alu, BFG_ALU_CARRY);
+
+    bfg_int_add_lazy(g, alu, dst, src, n, carry, out);
+    bfg_int_flush(g, alu, dst, n, carry, 1, out);
+}
+
+/// dst[i..] += 1, rippling the carry through the zero tests right away
+static void int_increment(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    int i,
+    int n,
+    bfg_cell_t out
+) {
+    bfg_add(g, dst + i, 1);
+    if (i + 1 == n && out == BFG_NO_CELL)
+        return;
+    int_if_zero(g, alu, dst + i);
+    if (i + 1 < n)
+        int_increment(g, alu, dst, i + 1, n, out);
+    else
+        bfg_add(g, out, 1);
+    int_end_if_zero(g, alu, dst + i);
+}
+
+void bfg_int_add_eager(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    bfg_cell_t src,
+    int n,
+    bfg_cell_t out
+) {
+    if (!int_check(g, alu, dst, n) || !int_check(g, alu, src, n))
+        return;
+    for (int i = 0; i < n; i++) {
+        bfg_while(g, src + i);
+        bfg_add_here(g, -1);
+        int_increment(g, alu, dst, i, n, out);
+        bfg_end_at(g, src + i);
+    }
+}
+
+void bfg_int_sub(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    bfg_cell_t src,
+    int n,
+    bfg_cell_t out
+) {
+    bfg_cell_t borrow = bfg_alu_reg(alu, BFG_ALU_CARRY);
+
+    bfg_int_sub_lazy(g, alu, dst, src, n, borrow, out);
+    bfg_int_flush(g, alu, dst, n, borrow, -1, out);
+}
+
+void bfg_int_divmod_byte(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t x,
+    int k,
+    bfg_cell_t q,
+    bfg_cell_t r
+) {
+    bfg_cell_t countdown = int_byte(alu, 0);
+
+    if (k < 2 || k > 255) {
+        bfg_fail(g, "byte divisor out of range");
+        return;
+    }
+    bfg_add(g, countdown, k);
+    bfg_while(g, x);
+    bfg_add_here(g, -1);
+    bfg_add(g, countdown, -1);
+    int_if_zero(g, alu, countdown);
+    bfg_add(g, countdown, k);
+    bfg_add(g, q, 1);
+    int_end_if_zero(g, alu, countdown);
+    bfg_end_at(g, x);
+
+    // r = k - countdown
+    bfg_add(g, r, k);
+    bfg_while(g, countdown);
+    bfg_add_here(g, -1);
+    bfg_add(g, r, -1);
+    bfg_end_at(g, countdown);
+}
+
+void bfg_int_shl(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int n, int bits) {
+    bfg_cell_t q = int_byte(alu, 1);
+    bfg_cell_t r = int_byte(alu, 2);
+    int bytes = bits / 8;
+    int s = bits % 8;
+
+    if (!int_check(g, alu, x, n) || bits <= 0)
+        return;
+    if (bytes >= n) {
+        bfg_int_clear(g, alu, x, n);
+        return;
+    }
+    for (int i = n - bytes; i < n; i++)
+        bfg_clear(g, x + i);
+    for (int i = n - 1 - bytes; i >= 0 && bytes > 0; i--)
+        bfg_move(g, x + i, x + i + bytes);
+    if (s == 0)
+        return;
+
+    // byte i = hi * 2^(8-s) + lo: lo << s stays, hi goes up into byte i+1
+    for (int i = n - 1; i >= bytes; i--) {
+        int mul = 1 << s;
+
+        bfg_int_divmod_byte(g, alu, x + i, 1 << (8 - s), q, r);
+        bfg_transfer(g, r, 1, &(bfg_cell_t) { x + i }, &mul);
+        if (i + 1 < n)
+            bfg_move(g, q, x + i + 1);
+        else
+            bfg_clear(g, q);
+    }
+}
+
+void bfg_int_shr(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int n, int bits) {
+    bfg_cell_t q = int_byte(alu, 1);
+    bfg_cell_t r = int_byte(alu, 2);
+    int bytes = bits / 8;
+    int s = bits % 8;
+
+    if (!int_check(g, alu, x, n) || bits <= 0)
+        return;
+    if (bytes >= n) {
+        bfg_int_clear(g, alu, x, n);
+        return;
+    }
+    for (int i = 0; i < bytes; i++)
+        bfg_clear(g, x + i);
+    for (int i = bytes; i < n && bytes > 0; i++)
+        bfg_move(g, x + i, x + i - bytes);
+    if (s == 0)
+        return;
+
+    // byte i = hi * 2^s + lo: hi stays, lo goes down into the top of byte i-1
+    for (int i = 0; i < n - bytes; i++) {
+        int mul = 1 << (8 - s);
+
+        bfg_int_divmod_byte(g, alu, x + i, 1 << s, q, r);
+        bfg_move(g, q, x + i);
+        if (i > 0)
+            bfg_transfer(g, r, 1, &(bfg_cell_t) { x + i - 1 }, &mul);
+        else
+            bfg_clear(g, r);
+    }
+}
+
+/// sign += top bit of the byte x (x is preserved)
+static void int_sign_bit(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, bfg_cell_t sign) {
+    bfg_cell_t top = int_byte(alu, 4);
+    bfg_cell_t low = int_byte(alu, 5);
+
+    bfg_copy(g, x, top, low);
+    bfg_int_divmod_byte(g, alu, top, 128, sign, low);
+    bfg_clear(g, low);
+}
+
+void bfg_int_sar(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int n, int bits) {
+    bfg_cell_t sign = int_byte(alu, 3);
+    int total = 8 * n;
+
+    if (!int_check(g, alu, x, n) || bits <= 0)
+        return;
+    if (bits > total)
+        bits = total;
+    int_sign_bit(g, alu, x + n - 1, sign);
+    bfg_int_shr(g, alu, x, n, bits);
+
+    // the vacated top bits are zero now, so the ones are added without carries
+    bfg_while(g, sign);
+    bfg_add_here(g, -1);
+    for (int i = 0; i < n; i++) {
+        int low_bit = 8 * i;
+        int first = total - bits;
+        int mask = 0;
+
+        for (int b = 0; b < 8; b++) {
+            if (low_bit + b >= first)
+                mask |= 1 << b;
+        }
+        bfg_add(g, x + i, mask);
+    }
+    bfg_end_at(g, sign);
+}
+
+void bfg_int_sext(bfg_t* g, const bfg_alu_t* alu, bfg_cell_t x, int from, int to) {
+    bfg_cell_t sign = int_byte(alu, 3);
+
+    if (!int_check(g, alu, x, to) || from < 1 || from >= to)
+        return;
+    int_sign_bit(g, alu, x + from - 1, sign);
+    bfg_while(g, sign);
+    bfg_add_here(g, -1);
+    for (int i = from; i < to; i++)
+        bfg_add(g, x + i, -1);
+    bfg_end_at(g, sign);
+}
+
+/// dst += a if the bit is set; the carries stay pending until the end
+static void int_mul_step(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    int n,
+    bfg_cell_t a,
+    bfg_cell_t bit
+) {
+    bfg_cell_t pending = bfg_alu_reg(alu, BFG_ALU_PENDING);
+    bfg_cell_t arg = bfg_alu_reg(alu, BFG_ALU_ARG);
+
+    bfg_while(g, bit);
+    bfg_add_here(g, -1);
+    bfg_int_copy(g, alu, arg, a, n);
+    bfg_int_add_lazy(g, alu, dst, arg, n, pending, BFG_NO_CELL);
+    bfg_end_at(g, bit);
+}
+
+void bfg_int_mul(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    int n,
+    bfg_cell_t a,
+    bfg_cell_t b,
+    int nb
+) {
+    bfg_cell_t pending = bfg_alu_reg(alu, BFG_ALU_PENDING);
+    bfg_cell_t arg = bfg_alu_reg(alu, BFG_ALU_ARG);
+    bfg_cell_t half = int_byte(alu, 1);
+    bfg_cell_t bit = int_byte(alu, 2);
+    bfg_cell_t counter = int_byte(alu, 6);
+
+    if (!int_check(g, alu, dst, n) || !int_check(g, alu, a, n) || !int_check(g, alu, b, nb))
+        return;
+    bfg_int_clear(g, alu, dst, n);
+    for (int j = 0; j < nb; j++) {
+        bool last = j == nb - 1;
+
+        // a is doubled after every bit but the very last one
+        bfg_add(g, counter, last ? 7 : 8);
+        bfg_while(g, counter);
+        bfg_add_here(g, -1);
+        bfg_int_divmod_byte(g, alu, b + j, 2, half, bit);
+        bfg_move(g, half, b + j);
+        int_mul_step(g, alu, dst, n, a, bit);
+        bfg_int_copy(g, alu, arg, a, n);
+        bfg_int_add(g, alu, a, arg, n, BFG_NO_CELL);
+        bfg_end_at(g, counter);
+
+        if (last) {
+            bfg_move(g, b + j, bit);
+            int_mul_step(g, alu, dst, n, a, bit);
+        }
+    }
+    bfg_int_flush(g, alu, dst, n, pending, 1, BFG_NO_CELL);
+    bfg_int_clear(g, alu, a, n);
+}
+
+void bfg_int_mul_school(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    int n,
+    bfg_cell_t a,
+    bfg_cell_t b,
+    int nb
+) {
+    bfg_cell_t arg = bfg_alu_reg(alu, BFG_ALU_ARG);
+
+    if (!int_check(g, alu, dst, n) || !int_check(g, alu, a, n) || !int_check(g, alu, b, nb))
+        return;
+    bfg_int_clear(g, alu, dst, n);
+    for (int j = 0; j < nb && j < n; j++) {
+        bfg_while(g, b + j);
+        bfg_add_here(g, -1);
+        bfg_int_copy(g, alu, arg, a, n - j);
+        bfg_int_add(g, alu, dst + j, arg, n - j, BFG_NO_CELL);
+        bfg_end_at(g, b + j);
+    }
+    bfg_int_clear(g, alu, b, nb);
+    bfg_int_clear(g, alu, a, n);
+}
+
+void bfg_int_mul_karatsuba(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t dst,
+    bfg_cell_t a,
+    bfg_cell_t b,
+    int h,
+    bfg_cell_t scratch
+) {
+    bfg_cell_t x = scratch;
+    bfg_cell_t y = scratch + alu->width;
+    bfg_cell_t z = scratch + 2 * alu->width;
+
+    if (h < 1 || 4 * h > alu->width) {
+        bfg_fail(g, "karatsuba operand size out of range");
+        return;
+    }
+    if (!int_check(g, alu, dst, 4 * h) || !int_check(g, alu, z, alu->width))
+        return;
+    bfg_int_clear(g, alu, dst, 4 * h);
+
+    // z0 = a0 * b0 into the low half of dst, z2 = a1 * b1 into z
+    bfg_int_copy(g, alu, x, a, h);
+    bfg_int_copy(g, alu, y, b, h);
+    bfg_int_mul(g, alu, dst, 2 * h, x, y, h);
+    bfg_int_copy(g, alu, x, a + h, h);
+    bfg_int_copy(g, alu, y, b + h, h);
+    bfg_int_mul(g, alu, z, 2 * h, x, y, h);
+
+    // a0 + a1 and b0 + b1 in place, h + 1 bytes each
+    bfg_int_move(g, alu, x, a + h, h);
+    bfg_int_add(g, alu, a, x, h, a + h);
+    bfg_int_move(g, alu, x, b + h, h);
+    bfg_int_add(g, alu, b, x, h, b + h);
+
+    // z1 = (a0 + a1)(b0 + b1) - z0 - z2
+    bfg_int_mul(g, alu, x, 2 * h + 1, a, b, h + 1);
+    bfg_int_copy(g, alu, y, dst, 2 * h);
+    bfg_int_sub(g, alu, x, y, 2 * h + 1, BFG_NO_CELL);
+    bfg_int_copy(g, alu, y, z, 2 * h);
+    bfg_int_sub(g, alu, x, y, 2 * h + 1, BFG_NO_CELL);
+
+    bfg_int_move(g, alu, dst + 2 * h, z, 2 * h);
+    bfg_int_add(g, alu, dst + h, x, 3 * h, BFG_NO_CELL);
+}
+
+void bfg_int_divmod(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t q,
+    bfg_cell_t r,
+    bfg_cell_t a,
+    bfg_cell_t b,
+    int n
+) {
+    bfg_cell_t arg = bfg_alu_reg(alu, BFG_ALU_ARG);
+    bfg_cell_t trial = bfg_alu_reg(alu, BFG_ALU_WORK);
+    bfg_cell_t top = int_byte(alu, 1);
+    bfg_cell_t overflow = int_byte(alu, 2);
+    bfg_cell_t borrow = int_byte(alu, 3);
+    bfg_cell_t fits = int_byte(alu, 4);
+    bfg_cell_t counter = int_byte(alu, 6);
+
+    if (!int_check(g, alu, q, n) || !int_check(g, alu, r, n)
+            || !int_check(g, alu, a, n) || !int_check(g, alu, b, n))
+        return;
+    bfg_int_clear(g, alu, q, n);
+    bfg_int_clear(g, alu, r, n);
+    bfg_add(g, counter, 8 * n);
+    bfg_while(g, counter);
+    bfg_add_here(g, -1);
+    // shift the top bit of a into r
+    bfg_int_copy(g, alu, arg, a, n);
+    bfg_int_add(g, alu, a, arg, n, top);
+    bfg_int_copy(g, alu, arg, r, n);
+    bfg_int_add(g, alu, r, arg, n, overflow);
+    bfg_move(g, top, r);
+    bfg_int_copy(g, alu, arg, q, n);
+    bfg_int_add(g, alu, q, arg, n, BFG_NO_CELL);
+
+    // b fits unless the trial borrows; if r overflowed it always fits
+    bfg_int_copy(g, alu, trial, r, n);
+    bfg_int_copy(g, alu, arg, b, n);
+    bfg_int_sub(g, alu, trial, arg, n, borrow);
+    bfg_add(g, fits, 1);
+    bfg_transfer(g, borrow, 1, &fits, &(int) { -1 });
+    bfg_move(g, overflow, fits);
+
+    bfg_while(g, fits);
+    bfg_add_here(g, -1);
+    bfg_add(g, q, 1);
+    bfg_int_move(g, alu, r, trial, n);
+    bfg_end_at(g, fits);
+    bfg_int_clear(g, alu, trial, n);
+    bfg_end_at(g, counter);
+    bfg_int_clear(g, alu, b, n);
+}
+
+void bfg_int_lt(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t flag,
+    bfg_cell_t a,
+    bfg_cell_t b,
+    int n,
+    bool is_signed
+) {
+    bfg_cell_t arg = bfg_alu_reg(alu, BFG_ALU_ARG);
+    bfg_cell_t trial = bfg_alu_reg(alu, BFG_ALU_WORK);
+
+    bfg_clear(g, flag);
+    bfg_int_copy(g, alu, trial, a, n);
+    bfg_int_copy(g, alu, arg, b, n);
+    if (is_signed) {
+        // flipping both sign bits turns the signed order into the unsigned one
+        bfg_add(g, trial + n - 1, 128);
+        bfg_add(g, arg + n - 1, 128);
+    }
+    bfg_int_sub(g, alu, trial, arg, n, flag);
+    bfg_int_clear(g, alu, trial, n);
+}
+
+void bfg_int_eq(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t flag,
+    bfg_cell_t a,
+    bfg_cell_t b,
+    int n
+) {
+    bfg_cell_t arg = bfg_alu_reg(alu, BFG_ALU_ARG);
+    bfg_cell_t trial = bfg_alu_reg(alu, BFG_ALU_WORK);
+
+    bfg_set(g, flag, 1);
+    bfg_int_copy(g, alu, trial, a, n);
+    bfg_int_copy(g, alu, arg, b, n);
+    bfg_int_sub(g, alu, trial, arg, n, BFG_NO_CELL);
+    for (int i = 0; i < n; i++) {
+        bfg_while(g, trial + i);
+        bfg_clear_here(g);
+        bfg_clear(g, flag);
+        bfg_end_at(g, trial + i);
+    }
+}
+
+void bfg_int_switch(
+    bfg_t* g,
+    const bfg_alu_t* alu,
+    bfg_cell_t x,
+    int n,
+    uint64_t lo,
+    int count,
+    bfg_case_fn emit_case,
+    void* ctx
+) {
+    bfg_cell_t arg = bfg_alu_reg(alu, BFG_ALU_ARG);
+    bfg_cell_t high = int_byte(alu, 0);
+
+    if (!int_check(g, alu, x, n))
+        return;
+    if (count < 1 || count > 255) {
+        bfg_fail(g, "bad switch");
+        return;
+    }
+    bfg_int_set(g, alu, arg, n, lo);
+    bfg_int_sub(g, alu, x, arg, n, BFG_NO_CELL);
+    // x - lo above 255: send the low byte past the last case
+    for (int i = 1; i < n; i++) {
+        bfg_while(g, x + i);
+        bfg_clear_here(g);
+        bfg_set(g, high, 1);
+        bfg_end_at(g, x + i);
+    }
+    bfg_while(g, high);
+    bfg_clear_here(g);
+    bfg_set(g, x, count);
+    bfg_end_at(g, high);
+    bfg_switch(g, x, int_byte(alu, 1), count, emit_case, ctx);
+}
@@ -0,0 +1,490 @@
+#include <bfgen.h>
+#include <bfgen_bench.h>
+#include <bfint.h>
+#include <bfreg.h>
+#include <bfvm.h>
+#include <stdio.h>
+
+#define BENCH_TAPE_SIZE 0x1000
+#define BENCH_RUNS 8
+
+/// Operands go to A and B, the result is read from C
+enum { REG_A = BFG_ALU_USER, REG_B, REG_C, REG_D, REG_S, REGISTERS = REG_S + 3 };
+
+typedef struct bench_case {
+    const char* name;
+    void (*emit)(bfg_t* g, const bfg_alu_t* alu);
+    uint64_t (*expect)(uint32_t a, uint32_t b);
+} bench_case_t;
+
+static uint32_t bench_random_state = 2024;
+
+static uint32_t bench_random(void) {
+    bench_random_state = bench_random_state * 1103515245u + 12345u;
+    return (bench_random_state >> 16) | ((bench_random_state << 8) & 0xffff0000u);
+}
+
+static bfg_cell_t R(const bfg_alu_t* alu, int r) {
+    return bfg_alu_reg(alu, r);
+}
+
+static void emit_add(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_add(g, alu, R(alu, REG_A), R(alu, REG_B), 4, BFG_NO_CELL);
+    bfg_int_move(g, alu, R(alu, REG_C), R(alu, REG_A), 4);
+}
+
+static void emit_add_eager(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_add_eager(g, alu, R(alu, REG_A), R(alu, REG_B), 4, BFG_NO_CELL);
+    bfg_int_move(g, alu, R(alu, REG_C), R(alu, REG_A), 4);
+}
+
+static uint64_t expect_add(uint32_t a, uint32_t b) {
+    return (uint32_t) (a + b);
+}
+
+static void emit_sub(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_sub(g, alu, R(alu, REG_A), R(alu, REG_B), 4, BFG_NO_CELL);
+    bfg_int_move(g, alu, R(alu, REG_C), R(alu, REG_A), 4);
+}
+
+static uint64_t expect_sub(uint32_t a, uint32_t b) {
+    return (uint32_t) (a - b);
+}
+
+static void emit_shl(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_shl(g, alu, R(alu, REG_A), 4, 13);
+    bfg_int_move(g, alu, R(alu, REG_C), R(alu, REG_A), 4);
+}
+
+static uint64_t expect_shl(uint32_t a, uint32_t b) {
+    (void) b;
+    return (uint32_t) (a << 13);
+}
+
+static void emit_shr(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_shr(g, alu, R(alu, REG_A), 4, 13);
+    bfg_int_move(g, alu, R(alu, REG_C), R(alu, REG_A), 4);
+}
+
+static uint64_t expect_shr(uint32_t a, uint32_t b) {
+    (void) b;
+    return a >> 13;
+}
+
+static void emit_sar(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_sar(g, alu, R(alu, REG_A), 4, 13);
+    bfg_int_move(g, alu, R(alu, REG_C), R(alu, REG_A), 4);
+}
+
+static uint64_t expect_sar(uint32_t a, uint32_t b) {
+    (void) b;
+    return (uint32_t) ((int32_t) a >> 13);
+}
+
+static void emit_mul32(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_mul(g, alu, R(alu, REG_C), 4, R(alu, REG_A), R(alu, REG_B), 4);
+}
+
+static uint64_t expect_mul32(uint32_t a, uint32_t b) {
+    return (uint32_t) (a * b);
+}
+
+static void emit_mul64(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_mul(g, alu, R(alu, REG_C), 8, R(alu, REG_A), R(alu, REG_B), 4);
+}
+
+static void emit_mul64_school(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_mul_school(g, alu, R(alu, REG_C), 8, R(alu, REG_A), R(alu, REG_B), 4);
+}
+
+static void emit_mul64_karatsuba(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_mul_karatsuba(g, alu, R(alu, REG_C), R(alu, REG_A), R(alu, REG_B), 2, R(alu, REG_S));
+}
+
+static uint64_t expect_mul64(uint32_t a, uint32_t b) {
+    return (uint64_t) a * b;
+}
+
+/// doom/m_fixed.c FixedMul: ((long long) a * b) >> FRACBITS
+static void emit_fixed_mul(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_sext(g, alu, R(alu, REG_A), 4, 8);
+    bfg_int_sext(g, alu, R(alu, REG_B), 4, 8);
+    bfg_int_mul(g, alu, R(alu, REG_D), 8, R(alu, REG_A), R(alu, REG_B), 8);
+    bfg_int_shr(g, alu, R(alu, REG_D), 8, 16);
+    bfg_int_move(g, alu, R(alu, REG_C), R(alu, REG_D), 4);
+    bfg_int_clear(g, alu, R(alu, REG_D), 8);
+}
+
+static uint64_t expect_fixed_mul(uint32_t a, uint32_t b) {
+    return (uint32_t) (((int64_t) (int32_t) a * (int32_t) b) >> 16);
+}
+
+static void emit_divmod(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_divmod(g, alu, R(alu, REG_C), R(alu, REG_D), R(alu, REG_A), R(alu, REG_B), 4);
+    bfg_int_clear(g, alu, R(alu, REG_D), 4);
+}
+
+static uint64_t expect_divmod(uint32_t a, uint32_t b) {
+    return b ? a / b : 0xffffffffu;
+}
+
+static void emit_lt(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_lt(g, alu, R(alu, REG_C), R(alu, REG_A), R(alu, REG_B), 4, true);
+    bfg_int_clear(g, alu, R(alu, REG_A), 4);
+    bfg_int_clear(g, alu, R(alu, REG_B), 4);
+}
+
+static uint64_t expect_lt(uint32_t a, uint32_t b) {
+    return (int32_t) a < (int32_t) b;
+}
+
+static void emit_eq(bfg_t* g, const bfg_alu_t* alu) {
+    bfg_int_eq(g, alu, R(alu, REG_C), R(alu, REG_A), R(alu, REG_B), 4);
+    bfg_int_clear(g, alu, R(alu, REG_A), 4);
+    bfg_int_clear(g, alu, R(alu, REG_B), 4);
+}
+
+static uint64_t expect_eq(uint32_t a, uint32_t b) {
+    return a == b;
+}
+
+static const bench_case_t bench_cases[] = {
+    { "add32 (lazy carries)", emit_add, expect_add },
+    { "add32 (eager ripple)", emit_add_eager, expect_add },
+    { "sub32", emit_sub, expect_sub },
+    { "shl32 13", emit_shl, expect_shl },
+    { "shr32 13", emit_shr, expect_shr },
+    { "sar32 13", emit_sar, expect_sar },
+    { "lt32 signed", emit_lt, expect_lt },
+    { "eq32", emit_eq, expect_eq },
+    { "mul32", emit_mul32, expect_mul32 },
+    { "mul32x32->64 shift-add", emit_mul64, expect_mul64 },
+    { "mul32x32->64 karatsuba", emit_mul64_karatsuba, expect_mul64 },
+    { "mul32x32->64 schoolbook", emit_mul64_school, expect_mul64 },
+    { "FixedMul", emit_fixed_mul, expect_fixed_mul },
+    { "divmod32", emit_divmod, expect_divmod },
+};
+
+/// Generates, runs and checks one case; returns false on a wrong result or
+/// when the case cannot be run, which leaves *stats untouched
+static bool bench_run(
+    const bench_case_t* c,
+    const bfg_alu_t* alu,
+    uint32_t a,
+    uint32_t b,
+    size_t* code_size,
+    bfvm_stats_t* stats
+) {
+    bfvm_status_t status;
+    bool ok = true;
+    bfg_t g;
+    bfvm_t vm;
+
+    bfg_init(&g);
+    bfg_int_set(&g, alu, R(alu, REG_A), 4, a);
+    bfg_int_set(&g, alu, R(alu, REG_B), 4, b);
+    // only the routine itself is measured: the setup runs first and is subtracted
+    size_t setup = g.code.length;
+    c->emit(&g, alu);
+    if (g.error) {
+        printf("%s: generation failed: %s\n", c->name, g.error);
+        bfg_free(&g);
+        return false;
+    }
+    *code_size = g.code.length - setup;
+
+    if (!bfvm_init(&vm, BENCH_TAPE_SIZE)) {
+        bfg_free(&g);
+        return false;
+    }
+
+    // cost of the setup alone
+    char saved = g.code.data[setup];
+    g.code.data[setup] = 0;
+    status = bfvm_load(&vm, g.code.data);
+    if (status == BFVM_OK)
+        status = bfvm_run(&vm, 0);
+    g.code.data[setup] = saved;
+    bfvm_stats_t before = vm.stats;
+
+    if (status == BFVM_OK)
+        status = bfvm_load(&vm, bfg_code(&g));
+    if (status == BFVM_OK)
+        status = bfvm_run(&vm, 0);
+    if (status != BFVM_OK) {
+        printf("%s: %s\n", c->name, bfvm_status_name(status));
+        ok = false;
+    } else {
+        uint64_t result = 0;
+        for (int i = 7; i >= 0; i--)
+            result = (result << 8) | vm.tape[R(alu, REG_C) + i];
+        if (result != c->expect(a, b)) {
+            printf("%s: %08x, %08x gave %016llx\n", c->name, a, b, (unsigned long long) result);
+            ok = false;
+        }
+    }
+    stats->ops = vm.stats.ops - before.ops;
+    stats->commands = vm.stats.commands - before.commands;
+
+    bfvm_free(&vm);
+    bfg_free(&g);
+    return ok;
+}
+
+/// Frame cells of the locals of the register allocation bench, left of the ALU
+enum { LOCAL_X = 2, LOCAL_Y = 6, LOCAL_Z = 10, ALU_BASE = 16 };
+
+/// How bench_block compiles its statements
+typedef enum block_mode {
+    /// Loads and stores the locals of every statement, like tcc's value stack
+    BLOCK_SPILL,
+    /// Keeps the locals in registers, reads y with bfg_int_copy
+    BLOCK_REGS,
+    /// Registers, reads y with bfg_regs_copy
+    BLOCK_COPY,
+} block_mode_t;
+
+static const char* const block_mode_names[] = {
+    "spill every statement",
+    "registers per block",
+    "+ one-pass copies",
+};
+
+/// x += y; y += z; z += x; repeated four times
+static uint64_t bench_block(const bfg_alu_t* alu, block_mode_t mode, size_t* code_size) {
+    static const bfg_cell_t order[] = { LOCAL_X, LOCAL_Y, LOCAL_Z, LOCAL_X };
+    bfg_cell_t tmp = R(alu, REG_S);
+    uint64_t ops = 0;
+    bfg_regs_t ra;
+    bfg_t g;
+    bfvm_t vm;
+
+    if (!bfg_regs_init(&ra, alu, REG_A, REG_S - REG_A))
+        return 0;
+    bfg_init(&g);
+    for (int i = 0; i < 4; i++) {
+        bfg_set(&g, LOCAL_X + i, (int) (bench_random() & 0xff));
+        bfg_set(&g, LOCAL_Y + i, (int) (bench_random() & 0xff));
+        bfg_set(&g, LOCAL_Z + i, (int) (bench_random() & 0xff));
+    }
+    size_t setup = g.code.length;
+    for (int statement = 0; statement < 12; statement++) {
+        bfg_cell_t dst = order[statement % 3];
+        bfg_cell_t src = order[statement % 3 + 1];
+
+        if (mode == BLOCK_COPY)
+            bfg_regs_copy(&g, &ra, src, 4, &tmp, 1, false);
+        else
+            bfg_int_copy(&g, alu, tmp, bfg_regs_use(&g, &ra, src, 4), 4);
+        bfg_int_add(&g, alu, bfg_regs_use(&g, &ra, dst, 4), tmp, 4, BFG_NO_CELL);
+        if (mode == BLOCK_SPILL)
+            bfg_regs_flush(&g, &ra);
+    }
+    bfg_regs_flush(&g, &ra);
+    *code_size = g.code.length - setup;
+
+    if (g.error == NULL && bfvm_init(&vm, BENCH_TAPE_SIZE)) {
+        char saved = g.code.data[setup];
+        g.code.data[setup] = 0;
+        if (bfvm_load(&vm, g.code.data) == BFVM_OK && bfvm_run(&vm, 0) == BFVM_OK)
+            ops -= vm.stats.ops;
+        g.code.data[setup] = saved;
+        if (bfvm_load(&vm, bfg_code(&g)) == BFVM_OK && bfvm_run(&vm, 0) == BFVM_OK)
+            ops += vm.stats.ops;
+        bfvm_free(&vm);
+    }
+    bfg_free(&g);
+    return ops;
+}
+
+#define SWITCH_CASES 16
+
+static void bench_case_body(bfg_t* g, int index, void* ctx) {
+    bfg_set(g, *(bfg_cell_t*) ctx, index + 1);
+}
+
+/**
+* switch (a) over SWITCH_CASES dense cases as a chain of bfg_int_eq
+* compares (what tccgen's compare/branch lowering comes to) or decoded by
+* bfg_int_switch. Returns the ops of the switch, 0 on a wrong case.
+*/
+static uint64_t bench_switch(const bfg_alu_t* alu, bool chain, uint32_t a, size_t* code_size) {
+    bfg_cell_t out = R(alu, REG_C);
+    bfg_cell_t flag = R(alu, REG_S);
+    uint64_t ops = 0;
+    bfg_t g;
+    bfvm_t vm;
+
+    bfg_init(&g);
+    bfg_int_set(&g, alu, R(alu, REG_A), 4, a);
+    size_t setup = g.code.length;
+    if (chain) {
+        for (int k = 0; k < SWITCH_CASES; k++) {
+            bfg_int_set(&g, alu, R(alu, REG_B), 4, (uint32_t) k);
+            bfg_int_eq(&g, alu, flag, R(alu, REG_A), R(alu, REG_B), 4);
+            bfg_int_clear(&g, alu, R(alu, REG_B), 4);
+            bfg_while(&g, flag);
+            bfg_clear_here(&g);
+            bench_case_body(&g, k, &out);
+            bfg_end_at(&g, flag);
+        }
+        bfg_int_clear(&g, alu, R(alu, REG_A), 4);
+    } else {
+        bfg_int_switch(&g, alu, R(alu, REG_A), 4, 0, SWITCH_CASES, bench_case_body, &out);
+    }
+    *code_size = g.code.length - setup;
+
+    if (g.error == NULL && bfvm_init(&vm, BENCH_TAPE_SIZE)) {
+        char saved = g.code.data[setup];
+        g.code.data[setup] = 0;
+        if (bfvm_load(&vm, g.code.data) == BFVM_OK && bfvm_run(&vm, 0) == BFVM_OK)
+            ops -= vm.stats.ops;
+        g.code.data[setup] = saved;
+        if (bfvm_load(&vm, bfg_code(&g)) == BFVM_OK && bfvm_run(&vm, 0) == BFVM_OK)
+            ops += vm.stats.ops;
+        if (vm.tape[out] != a + 1)
+            ops = 0;
+        bfvm_free(&vm);
+    }
+    bfg_free(&g);
+    return ops;
+}
+
+#define BLOCK_CELLS 64
+#define BLOCK_SRC 0x100
+#define BLOCK_DST 0x200
+
+/**
+* Moves BLOCK_CELLS random bytes, one transfer loop per byte, either in
+* descending order (nothing to fold, what a byte-by-byte memcpy comes to)
+* or with bfg_move_block. Returns the ops of the move, 0 on a wrong result.
+*/
+static uint64_t bench_move_block(bool folded, size_t* code_size, uint64_t* commands) {
+    uint8_t values[BLOCK_CELLS];
+    uint64_t ops = 0;
+    bfg_t g;
+    bfvm_t vm;
+
+    bfg_init(&g);
+    for (int i = 0; i < BLOCK_CELLS; i++) {
+        values[i] = (uint8_t) bench_random();
+        bfg_set(&g, BLOCK_SRC + i, values[i]);
+    }
+    size_t setup = g.code.length;
+    if (folded) {
+        bfg_move_block(&g, BLOCK_SRC, BLOCK_DST, BLOCK_CELLS);
+    } else {
+        for (int i = BLOCK_CELLS - 1; i >= 0; i--)
+            bfg_move(&g, BLOCK_SRC + i, BLOCK_DST + i);
+    }
+    *code_size = g.code.length - setup;
+
+    if (g.error == NULL && bfvm_init(&vm, BENCH_TAPE_SIZE)) {
+        char saved = g.code.data[setup];
+        g.code.data[setup] = 0;
+        if (bfvm_load(&vm, g.code.data) == BFVM_OK && bfvm_run(&vm, 0) == BFVM_OK) {
+            ops -= vm.stats.ops;
+            *commands -= vm.stats.commands;
+        }
+        g.code.data[setup] = saved;
+        if (bfvm_load(&vm, bfg_code(&g)) == BFVM_OK && bfvm_run(&vm, 0) == BFVM_OK) {
+            ops += vm.stats.ops;
+            *commands += vm.stats.commands;
+        }
+        for (int i = 0; i < BLOCK_CELLS; i++) {
+            if (vm.tape[BLOCK_DST + i] != values[i] || vm.tape[BLOCK_SRC + i] != 0)
+                ops = 0;
+        }
+        bfvm_free(&vm);
+    }
+    bfg_free(&g);
+    return ops;
+}
+
+int run_bfint_bench(void) {
+    bfg_alu_t alu;
+    bool ok = true;
+
+    if (!bfg_alu_init(&alu, ALU_BASE, REGISTERS, 8))
+        return 1;
+    printf("%-26s %8s %12s %14s\n", "routine", "code", "ops", "commands");
+    for (size_t i = 0; i < sizeof(bench_cases) / sizeof(bench_cases[0]); i++) {
+        const bench_case_t* c = &bench_cases[i];
+        uint64_t ops = 0;
+        uint64_t commands = 0;
+        size_t code_size = 0;
+        bool row_ok = true;
+
+        bench_random_state = 2024;
+        for (int run = 0; run < BENCH_RUNS && row_ok; run++) {
+            uint32_t a = bench_random();
+            uint32_t b = bench_random();
+            bfvm_stats_t stats = { 0 };
+
+            row_ok = bench_run(c, &alu, a, b, &code_size, &stats);
+            ops += stats.ops;
+            commands += stats.commands;
+        }
+        // a failed run leaves no meaningful averages
+        if (!row_ok) {
+            printf("%-26s %8s\n", c->name, "failed");
+            ok = false;
+            continue;
+        }
+        printf("%-26s %8zu %12llu %14llu\n", c->name, code_size,
+            (unsigned long long) (ops / BENCH_RUNS), (unsigned long long) (commands / BENCH_RUNS));
+    }
+    printf("ops and commands are averages over %d random operand pairs\n", BENCH_RUNS);
+
+    printf("\n%-26s %8s %12s\n", "12 statements x += y", "code", "ops");
+    for (int mode = BLOCK_SPILL; mode <= BLOCK_COPY; mode++) {
+        size_t code_size = 0;
+        uint64_t ops = 0;
+
+        bench_random_state = 2024;
+        for (int run = 0; run < BENCH_RUNS; run++)
+            ops += bench_block(&alu, (block_mode_t) mode, &code_size);
+        printf("%-26s %8zu %12llu\n", block_mode_names[mode], code_size,
+            (unsigned long long) (ops / BENCH_RUNS));
+    }
+
+    printf("\n%-26s %8s %12s\n", "switch, 16 cases", "code", "ops");
+    for (int chain = 1; chain >= 0; chain--) {
+        size_t code_size = 0;
+        uint64_t ops = 0;
+
+        bench_random_state = 2024;
+        for (int run = 0; run < BENCH_RUNS; run++) {
+            uint64_t run_ops = bench_switch(&alu, chain, bench_random() % SWITCH_CASES, &code_size);
+
+            if (run_ops == 0) {
+                printf("switch: wrong case\n");
+                ok = false;
+            }
+            ops += run_ops;
+        }
+        printf("%-26s %8zu %12llu\n", chain ? "compare chain" : "bfg_int_switch", code_size,
+            (unsigned long long) (ops / BENCH_RUNS));
+    }
+
+    printf("\n%-26s %8s %12s %14s\n", "move 64 bytes", "code", "ops", "commands");
+    for (int folded = 0; folded <= 1; folded++) {
+        size_t code_size = 0;
+        uint64_t ops = 0;
+        uint64_t commands = 0;
+
+        bench_random_state = 2024;
+        for (int run = 0; run < BENCH_RUNS; run++) {
+            uint64_t run_ops = bench_move_block(folded, &code_size, &commands);
+
+            if (run_ops == 0) {
+                printf("move block: wrong result\n");
+                ok = false;
+            }
+            ops += run_ops;
+        }
+        printf("%-26s %8zu %12llu %14llu\n", folded ? "bfg_move_block" : "per-byte transfers", code_size,
+            (unsigned long long) (ops / BENCH_RUNS), (unsigned long long) (commands / BENCH_RUNS));
+    }
+    return ok ? 0 : 1;
+}
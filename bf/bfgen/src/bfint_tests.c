@@ -0,0 +1,385 @@
+#include <bfgen.h>
+#include <bfgen_tests.h>
+#include <bfint.h>
+#include <bfreg.h>
+#include <bfvm.h>
+#include <assert.h>
+#include <stdio.h>
+
+#define TEST_TAPE_SIZE 0x1000
+
+/// REG_K is the first of three scratch registers for the Karatsuba product
+enum { REG_A = BFG_ALU_USER, REG_B, REG_C, REG_D, REG_S, REG_K, REGISTERS = REG_K + 3 };
+
+static uint32_t test_random_state = 777;
+
+static uint32_t test_random(void) {
+    test_random_state = test_random_state * 1103515245u + 12345u;
+    return (test_random_state >> 16) | ((test_random_state << 8) & 0xffff0000u);
+}
+
+static bfg_alu_t test_alu(void) {
+    bool res;
+    bfg_alu_t alu;
+
+    res = bfg_alu_init(&alu, 16, REGISTERS, 8);
+    assert(res);
+    assert(16 + bfg_alu_cells(&alu) < TEST_TAPE_SIZE);
+    return alu;
+}
+
+static bfg_cell_t reg(const bfg_alu_t* alu, int r) {
+    return bfg_alu_reg(alu, r);
+}
+
+static uint64_t read_int(const bfvm_t* vm, bfg_cell_t x, int n) {
+    uint64_t value = 0;
+
+    for (int i = n - 1; i >= 0; i--)
+        value = (value << 8) | vm->tape[x + i];
+    return value;
+}
+
+/// Runs the program and checks that the scratch registers and lanes are clean
+static void run_int(bfg_t* g, const bfg_alu_t* alu, bfvm_t* vm) {
+    bool res;
+    assert(g->error == NULL);
+    res = bfvm_init(vm, TEST_TAPE_SIZE);
+    assert(res);
+    res = bfvm_load(vm, bfg_code(g)) == BFVM_OK;
+    assert(res);
+    res = bfvm_run(vm, 0) == BFVM_OK;
+    assert(res);
+    for (long cell = reg(alu, 0); cell < reg(alu, BFG_ALU_USER); cell++)
+        assert(vm->tape[cell] == 0);
+    for (long cell = alu->base + alu->span; cell < alu->base + bfg_alu_cells(alu); cell++)
+        assert(vm->tape[cell] == 0);
+}
+
+static void check_add_sub(uint32_t a, uint32_t b) {
+    bfg_alu_t alu = test_alu();
+    bfg_cell_t carry = reg(&alu, REG_S);
+    bfg_cell_t borrow = carry + 1;
+    bfg_t g;
+    bfvm_t vm;
+
+    bfg_init(&g);
+    bfg_int_set(&g, &alu, reg(&alu, REG_A), 4, a);
+    bfg_int_set(&g, &alu, reg(&alu, REG_B), 4, b);
+    bfg_int_copy(&g, &alu, reg(&alu, REG_C), reg(&alu, REG_A), 4);
+    bfg_int_copy(&g, &alu, reg(&alu, REG_D), reg(&alu, REG_B), 4);
+    bfg_int_add(&g, &alu, reg(&alu, REG_A), reg(&alu, REG_B), 4, carry);
+    bfg_int_sub(&g, &alu, reg(&alu, REG_C), reg(&alu, REG_D), 4, borrow);
+    run_int(&g, &alu, &vm);
+
+    assert(read_int(&vm, reg(&alu, REG_A), 8) == (uint32_t) (a + b));
+    assert(read_int(&vm, reg(&alu, REG_C), 8) == (uint32_t) (a - b));
+    assert(read_int(&vm, reg(&alu, REG_B), 8) == 0);
+    assert(vm.tape[carry] == ((uint64_t) a + b > 0xffffffffu));
+    assert(vm.tape[borrow] == (a < b));
+
+    bfvm_free(&vm);
+    bfg_free(&g);
+}
+
+void test_bfint_add_sub(void) {
+    printf("Running test_bfint_add_sub... ");
+    check_add_sub(0xffffffffu, 1);
+    check_add_sub(0, 1);
+    check_add_sub(0x00ffff00u, 0x00000100u);
+    for (int i = 0; i < 6; i++)
+        check_add_sub(test_random(), test_random());
+    printf("OK\n");
+}
+
+void test_bfint_add_eager(void) {
+    printf("Running test_bfint_add_eager... ");
+    bfg_alu_t alu = test_alu();
+    bfg_cell_t carry = reg(&alu, REG_S);
+    bfg_t g;
+    bfvm_t vm;
+
+    bfg_init(&g);
+    bfg_int_set(&g, &alu, reg(&alu, REG_A), 4, 0xfffffff0u);
+    bfg_int_set(&g, &alu, reg(&alu, REG_B), 4, 0x00000123u);
+    bfg_int_add_eager(&g, &alu, reg(&alu, REG_A), reg(&alu, REG_B), 4, carry);
+    run_int(&g, &alu, &vm);
+    assert(read_int(&vm, reg(&alu, REG_A), 4) == 0x113);
+    assert(vm.tape[carry] == 1);
+    bfvm_free(&vm);
+    bfg_free(&g);
+    printf("OK\n");
+}
+
+static void check_shift(uint32_t x, int bits) {
+    bfg_alu_t alu = test_alu();
+    bfg_t g;
+    bfvm_t vm;
+
+    bfg_init(&g);
+    bfg_int_set(&g, &alu, reg(&alu, REG_A), 4, x);
+    bfg_int_set(&g, &alu, reg(&alu, REG_B), 4, x);
+    bfg_int_set(&g, &alu, reg(&alu, REG_C), 4, x);
+    bfg_int_set(&g, &alu, reg(&alu, REG_D), 2, x);
+    bfg_int_shl(&g, &alu, reg(&alu, REG_A), 4, bits);
+    bfg_int_shr(&g, &alu, reg(&alu, REG_B), 4, bits);
+    bfg_int_sar(&g, &alu, reg(&alu, REG_C), 4, bits);
+    bfg_int_sext(&g, &alu, reg(&alu, REG_D), 2, 8);
+    run_int(&g, &alu, &vm);
+
+    assert(read_int(&vm, reg(&alu, REG_A), 8) == (uint32_t) (x << bits));
+    assert(read_int(&vm, reg(&alu, REG_B), 8) == x >> bits);
+    assert(read_int(&vm, reg(&alu, REG_C), 8) == (uint32_t) ((int32_t) x >> bits));
+    assert(read_int(&vm, reg(&alu, REG_D), 8) == (uint64_t) (int64_t) (int16_t) x);
+
+    bfvm_free(&vm);
+    bfg_free(&g);
+}
+
+void test_bfint_shift(void) {
+    printf("Running test_bfint_shift... ");
+    check_shift(0x80000001u, 1);
+    check_shift(0x12345678u, 8);
+    check_shift(0xdeadbeefu, 13);
+    check_shift(0x7f00ff00u, 31);
+    check_shift(test_random(), 5);
+    printf("OK\n");
+}
+
+static void check_mul(uint32_t a, uint32_t b) {
+    bfg_alu_t alu = test_alu();
+    bfg_t g;
+    bfvm_t vm;
+
+    bfg_init(&g);
+    bfg_int_set(&g, &alu, reg(&alu, REG_A), 4, a);
+    bfg_int_set(&g, &alu, reg(&alu, REG_B), 4, b);
+    bfg_int_copy(&g, &alu, reg(&alu, REG_D), reg(&alu, REG_A), 4);
+    bfg_int_copy(&g, &alu, reg(&alu, REG_S), reg(&alu, REG_B), 4);
+    bfg_int_mul(&g, &alu, reg(&alu, REG_C), 8, reg(&alu, REG_A), reg(&alu, REG_B), 4);
+    bfg_int_mul_karatsuba(&g, &alu, reg(&alu, REG_A), reg(&alu, REG_D), reg(&alu, REG_S), 2,
+        reg(&alu, REG_K));
+    run_int(&g, &alu, &vm);
+
+    assert(read_int(&vm, reg(&alu, REG_C), 8) == (uint64_t) a * b);
+    assert(read_int(&vm, reg(&alu, REG_A), 8) == (uint64_t) a * b);
+    for (int r = REG_B; r < REGISTERS; r++) {
+        if (r != REG_C)
+            assert(read_int(&vm, reg(&alu, r), 8) == 0);
+    }
+
+    bfvm_free(&vm);
+    bfg_free(&g);
+}
+
+void test_bfint_mul(void) {
+    printf("Running test_bfint_mul... ");
+    check_mul(0xffffffffu, 0xffffffffu);
+    check_mul(0x10000u, 0x10000u);
+    check_mul(test_random(), test_random());
+
+    // the schoolbook variant costs a pass per unit of b, keep it small
+    bfg_alu_t alu = test_alu();
+    bfg_t g;
+    bfvm_t vm;
+
+    bfg_init(&g);
+    bfg_int_set(&g, &alu, reg(&alu, REG_A), 4, 0x12345u);
+    bfg_int_set(&g, &alu, reg(&alu, REG_B), 2, 0x0203u);
+    bfg_int_mul_school(&g, &alu, reg(&alu, REG_C), 4, reg(&alu, REG_A), reg(&alu, REG_B), 2);
+    run_int(&g, &alu, &vm);
+    assert(read_int(&vm, reg(&alu, REG_C), 8) == 0x12345u * 0x0203u);
+    bfvm_free(&vm);
+    bfg_free(&g);
+    printf("OK\n");
+}
+
+static void check_divmod(uint32_t a, uint32_t b) {
+    bfg_alu_t alu = test_alu();
+    bfg_t g;
+    bfvm_t vm;
+
+    bfg_init(&g);
+    bfg_int_set(&g, &alu, reg(&alu, REG_A), 4, a);
+    bfg_int_set(&g, &alu, reg(&alu, REG_B), 4, b);
+    bfg_int_divmod(&g, &alu, reg(&alu, REG_C), reg(&alu, REG_D), reg(&alu, REG_A), reg(&alu, REG_B), 4);
+    run_int(&g, &alu, &vm);
+
+    assert(read_int(&vm, reg(&alu, REG_C), 8) == (b ? a / b : 0xffffffffu));
+    assert(read_int(&vm, reg(&alu, REG_D), 8) == (b ? a % b : a));
+    assert(read_int(&vm, reg(&alu, REG_A), 8) == 0);
+    assert(read_int(&vm, reg(&alu, REG_B), 8) == 0);
+
+    bfvm_free(&vm);
+    bfg_free(&g);
+}
+
+void test_bfint_divmod(void) {
+    printf("Running test_bfint_divmod... ");
+    check_divmod(100, 7);
+    check_divmod(0xffffffffu, 0x80000001u);
+    check_divmod(0x1234u, 0);
+    check_divmod(test_random(), test_random() >> 12);
+    printf("OK\n");
+}
+
+static void check_compare(uint32_t a, uint32_t b) {
+    bfg_alu_t alu = test_alu();
+    bfg_cell_t flags = reg(&alu, REG_C);
+    bfg_t g;
+    bfvm_t vm;
+
+    bfg_init(&g);
+    bfg_int_set(&g, &alu, reg(&alu, REG_A), 4, a);
+    bfg_int_set(&g, &alu, reg(&alu, REG_B), 4, b);
+    bfg_int_lt(&g, &alu, flags, reg(&alu, REG_A), reg(&alu, REG_B), 4, false);
+    bfg_int_lt(&g, &alu, flags + 1, reg(&alu, REG_A), reg(&alu, REG_B), 4, true);
+    bfg_int_eq(&g, &alu, flags + 2, reg(&alu, REG_A), reg(&alu, REG_B), 4);
+    run_int(&g, &alu, &vm);
+
+    assert(vm.tape[flags] == (a < b));
+    assert(vm.tape[flags + 1] == ((int32_t) a < (int32_t) b));
+    assert(vm.tape[flags + 2] == (a == b));
+    assert(read_int(&vm, reg(&alu, REG_A), 8) == a);
+    assert(read_int(&vm, reg(&alu, REG_B), 8) == b);
+
+    bfvm_free(&vm);
+    bfg_free(&g);
+}
+
+void test_bfint_compare(void) {
+    printf("Running test_bfint_compare... ");
+    check_compare(1, 2);
+    check_compare(0xffffffffu, 1);
+    check_compare(0x80000000u, 0x7fffffffu);
+    check_compare(0x01020304u, 0x01020304u);
+    check_compare(0x01020304u, 0x01020305u);
+    printf("OK\n");
+}
+
+static void set_case(bfg_t* g, int index, void* ctx) {
+    bfg_set(g, *(bfg_cell_t*) ctx, index + 1);
+}
+
+void test_bfint_switch(void) {
+    printf("Running test_bfint_switch... ");
+    static const int32_t values[] = { -5, -3, 0, 4, 5, 300, -100000 };
+    bfg_alu_t alu = test_alu();
+    bfg_cell_t out = reg(&alu, REG_C);
+
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        int expected = values[i] >= -3 && values[i] < 5 ? values[i] + 3 : 8;
+        bfg_t g;
+        bfvm_t vm;
+
+        bfg_init(&g);
+        bfg_int_set(&g, &alu, reg(&alu, REG_A), 4, (uint32_t) values[i]);
+        bfg_int_switch(&g, &alu, reg(&alu, REG_A), 4, (uint32_t) -3, 8, set_case, &out);
+        run_int(&g, &alu, &vm);
+        assert(vm.tape[out] == expected + 1);
+        assert(read_int(&vm, reg(&alu, REG_A), 8) == 0);
+        bfvm_free(&vm);
+        bfg_free(&g);
+    }
+    printf("OK\n");
+}
+
+void test_bfreg_block(void) {
+    bool res;
+    printf("Running test_bfreg_block... ");
+    enum { X = 2, Y = 6, Z = 10 };
+    bfg_alu_t alu = test_alu();
+    bfg_cell_t tmp = reg(&alu, REG_S);
+    bfg_regs_t ra;
+    bfg_t g;
+    bfvm_t vm;
+
+    // two registers for three locals: the block has to evict
+    res = bfg_regs_init(&ra, &alu, REG_C, 2);
+    assert(res);
+    bfg_init(&g);
+    for (int i = 0; i < 4; i++) {
+        bfg_set(&g, X + i, (int) ((0x010203f4u >> (8 * i)) & 0xff));
+        bfg_set(&g, Y + i, (int) ((0x00000125u >> (8 * i)) & 0xff));
+        bfg_set(&g, Z + i, 0x77);
+    }
+
+    // x += y; z = x; y += 1;
+    bfg_int_copy(&g, &alu, tmp, bfg_regs_use(&g, &ra, Y, 4), 4);
+    bfg_int_add(&g, &alu, bfg_regs_use(&g, &ra, X, 4), tmp, 4, BFG_NO_CELL);
+    bfg_cell_t x = bfg_regs_use(&g, &ra, X, 4);
+    bfg_int_copy(&g, &alu, bfg_regs_def(&g, &ra, Z, 4), x, 4);
+    bfg_int_set(&g, &alu, tmp, 4, 1);
+    bfg_int_add(&g, &alu, bfg_regs_use(&g, &ra, Y, 4), tmp, 4, BFG_NO_CELL);
+    bfg_regs_flush(&g, &ra);
+    run_int(&g, &alu, &vm);
+
+    assert(read_int(&vm, X, 4) == 0x01020519u);
+    assert(read_int(&vm, Y, 4) == 0x00000126u);
+    assert(read_int(&vm, Z, 4) == 0x01020519u);
+    for (int r = REG_C; r < REGISTERS; r++)
+        assert(read_int(&vm, reg(&alu, r), 8) == 0);
+    assert(ra.loads == 3 && ra.stores == 4);
+
+    bfvm_free(&vm);
+    bfg_free(&g);
+    printf("OK\n");
+}
+
+void test_bfreg_copy(void) {
+    bool res;
+    printf("Running test_bfreg_copy... ");
+    enum { X = 2, Y = 6, Z = 10 };
+    bfg_alu_t alu = test_alu();
+    bfg_cell_t a = reg(&alu, REG_A);
+    bfg_cell_t b = reg(&alu, REG_B);
+    bfg_cell_t both[2] = { a, b };
+    bfg_regs_t ra;
+    bfg_t g;
+    bfvm_t vm;
+
+    res = bfg_regs_init(&ra, &alu, REG_C, 3);
+    assert(res);
+    bfg_init(&g);
+    for (int i = 0; i < 4; i++)
+        bfg_set(&g, X + i, (int) ((0x11223344u >> (8 * i)) & 0xff));
+
+    // a free register: x moves there instead of being restored
+    bfg_regs_copy(&g, &ra, X, 4, both, 2, false);
+    bfg_int_set(&g, &alu, bfg_regs_def(&g, &ra, Y, 4), 4, 5);
+    bfg_int_set(&g, &alu, bfg_regs_def(&g, &ra, Z, 4), 4, 7);
+    assert(ra.restores == 0);
+    // all registers taken: the loop back through BFG_ALU_TMP
+    bfg_regs_copy(&g, &ra, X, 4, &a, 1, false);
+    assert(ra.restores == 1);
+    // y is dead after the read, it is neither restored nor stored
+    bfg_regs_copy(&g, &ra, Y, 4, &b, 1, true);
+    bfg_regs_flush(&g, &ra);
+    run_int(&g, &alu, &vm);
+
+    assert(read_int(&vm, a, 8) == 0x11223344u);
+    assert(read_int(&vm, b, 8) == 5);
+    assert(read_int(&vm, X, 4) == 0x11223344u);
+    assert(read_int(&vm, Z, 4) == 7);
+    for (int r = REG_C; r < REGISTERS; r++)
+        assert(read_int(&vm, reg(&alu, r), 8) == 0);
+    assert(ra.loads == 1 && ra.stores == 2);
+
+    bfvm_free(&vm);
+    bfg_free(&g);
+    printf("OK\n");
+}
+
+void run_bfint_tests(void) {
+    printf("testing bfint...\n");
+    test_bfint_add_sub();
+    test_bfint_add_eager();
+    test_bfint_shift();
+    test_bfint_mul();
+    test_bfint_divmod();
+    test_bfint_compare();
+    test_bfint_switch();
+    test_bfreg_block();
+    test_bfreg_copy();
+    printf("All bfint tests passed!\n");
+}
@@ -0,0 +1,242 @@
+#include <bfmem.h>
+#include <limits.h>
+
+bool bfg_mem_init(
+    bfg_mem_t* mem,
+    int levels,
+    int fanout,
+    bool cached,
+    bfg_cell_t base,
+    bfg_cell_t frame
+) {
+    if (levels < 1 || levels > BFG_MEM_MAX_LEVELS)
+        return false;
+    if (fanout < 2 || fanout > 256)
+        return false;
+    if (frame < 0 || frame + BFG_MEM_FRAME_CELLS > base)
+        return false;
+
+    mem->levels = levels;
+    mem->fanout = fanout;
+    mem->cached = cached;
+    mem->base = base;
+    mem->flag = frame;
+    mem->tmp[0] = frame + 1;
+    mem->tmp[1] = frame + 2;
+    mem->cache[0] = -1;
+    for (int k = 1; k < BFG_MEM_MAX_LEVELS; k++)
+        mem->cache[k] = frame + 2 + k;
+
+    mem->block_size[0] = BFG_MEM_SLOT_SIZE;
+    for (int k = 1; k <= levels; k++) {
+        if (mem->block_size[k - 1] > (LONG_MAX - BFG_MEM_HEADER_SIZE) / fanout)
+            return false;
+        mem->block_size[k] = BFG_MEM_HEADER_SIZE + fanout * mem->block_size[k - 1];
+    }
+    return true;
+}
+
+unsigned long bfg_mem_capacity(const bfg_mem_t* mem) {
+    unsigned long capacity = 1;
+
+    for (int k = 0; k < mem->levels; k++)
+        capacity *= (unsigned long) mem->fanout;
+    return capacity;
+}
+
+bfg_cell_t bfg_mem_cell(const bfg_mem_t* mem, unsigned long address) {
+    unsigned long weight = bfg_mem_capacity(mem);
+    bfg_cell_t cell = mem->base;
+
+    for (int k = mem->levels - 1; k >= 0; k--) {
+        weight /= (unsigned long) mem->fanout;
+        cell += BFG_MEM_HEADER_SIZE + (long) (address / weight % (unsigned long) mem->fanout) * mem->block_size[k];
+    }
+    return cell + BFG_MEM_SLOT_DATA;
+}
+
+/*
+* Walks from the root down to the chosen block of `level` along the A
+* trails. The head must be static; it ends on the block's A mark.
+*/
+static void mem_descend(bfg_t* g, const bfg_mem_t* mem, int level) {
+    bfg_goto(g, mem->base);
+    for (int m = mem->levels - 1; m >= level; m--) {
+        bfg_move_rel(g, BFG_MEM_HEADER_SIZE);
+        bfg_glide(g, mem->block_size[m]);
+    }
+}
+
+/*
+* Walks from the B mark of the chosen block of `level` back to the root
+* along the B trails. The head is static again afterwards.
+*/
+static void mem_ascend(bfg_t* g, const bfg_mem_t* mem, int level) {
+    for (int m = level; m < mem->levels; m++) {
+        bfg_glide(g, -mem->block_size[m]);
+        bfg_move_rel(g, -BFG_MEM_HEADER_SIZE);
+    }
+    bfg_rebase(g, mem->base + BFG_MEM_MARK_B);
+}
+
+static void mem_enter_data(bfg_t* g, const bfg_mem_t* mem, int anchor) {
+    mem_descend(g, mem, 0);
+    bfg_move_rel(g, BFG_MEM_SLOT_DATA);
+    bfg_set_anchor(g, anchor, 0);
+}
+
+static void mem_leave_data(bfg_t* g, const bfg_mem_t* mem) {
+    bfg_move_rel(g, BFG_MEM_MARK_B - BFG_MEM_SLOT_DATA);
+    mem_ascend(g, mem, 0);
+}
+
+/*
+* Marks the first `index` children of the chosen level k+1 block: A marks
+* on children 0..index-1 and B marks on children 1..index. Consumes index.
+*/
+static void mem_lay_trail(bfg_t* g, const bfg_mem_t* mem, int k, bfg_cell_t index) {
+    long stride = mem->block_size[k];
+
+    bfg_while(g, index);
+    bfg_add_here(g, -1);
+    mem_descend(g, mem, k + 1);
+    bfg_move_rel(g, BFG_MEM_HEADER_SIZE);
+    bfg_glide(g, stride);
+    bfg_add_here(g, 1);
+    bfg_move_rel(g, stride + BFG_MEM_MARK_B);
+    bfg_add_here(g, 1);
+    bfg_glide(g, -stride);
+    bfg_move_rel(g, -BFG_MEM_HEADER_SIZE);
+    mem_ascend(g, mem, k + 1);
+    bfg_end_at(g, index);
+}
+
+/*
+* Erases the trail of level k. The trails above it must still be in place
+* since they are the way back to the root.
+*/
+static void mem_clear_trail(bfg_t* g, const bfg_mem_t* mem, int k) {
+    long stride = mem->block_size[k];
+
+    mem_descend(g, mem, k + 1);
+    bfg_move_rel(g, BFG_MEM_HEADER_SIZE);
+    bfg_glide_clear(g, stride);
+    bfg_move_rel(g, BFG_MEM_MARK_B);
+    bfg_glide_clear(g, -stride);
+    bfg_move_rel(g, -BFG_MEM_HEADER_SIZE);
+    mem_ascend(g, mem, k + 1);
+}
+
+/*
+* Lays the trails of every level above the leaves. In cached mode the
+* trails left by the previous access are reused when the page index
+* matches the cached one and rebuilt otherwise.
+*/
+static void mem_open_page(bfg_t* g, const bfg_mem_t* mem, const bfg_cell_t* addr) {
+    int levels = mem->levels;
+
+    if (levels == 1)
+        return;
+    if (!mem->cached) {
+        for (int k = levels - 1; k >= 1; k--)
+            mem_lay_trail(g, mem, k, addr[k]);
+        return;
+    }
+
+    for (int k = 1; k < levels; k++) {
+        bfg_cell_t diff[2] = { mem->tmp[0], mem->tmp[1] };
+        int sub[2] = { -1, 1 };
+
+        bfg_copy(g, addr[k], mem->tmp[0], mem->tmp[1]);
+        bfg_transfer(g, mem->cache[k], 2, diff, sub);
+        bfg_move(g, mem->tmp[1], mem->cache[k]);
+        bfg_while(g, mem->tmp[0]);
+        bfg_clear_here(g);
+        bfg_set(g, mem->flag, 1);
+        bfg_end_at(g, mem->tmp[0]);
+    }
+
+    bfg_while(g, mem->flag);
+    for (int k = 1; k < levels; k++)
+        mem_clear_trail(g, mem, k);
+    for (int k = 1; k < levels; k++) {
+        bfg_clear(g, mem->cache[k]);
+        bfg_copy(g, addr[k], mem->cache[k], mem->tmp[0]);
+    }
+    for (int k = levels - 1; k >= 1; k--)
+        mem_lay_trail(g, mem, k, addr[k]);
+    bfg_clear(g, mem->flag);
+    bfg_end_at(g, mem->flag);
+
+    for (int k = 1; k < levels; k++)
+        bfg_clear(g, addr[k]);
+}
+
+static void mem_close_page(bfg_t* g, const bfg_mem_t* mem) {
+    mem_clear_trail(g, mem, 0);
+    if (mem->cached)
+        return;
+    for (int k = 1; k < mem->levels; k++)
+        mem_clear_trail(g, mem, k);
+}
+
+void bfg_mem_load(
+    bfg_t* g,
+    const bfg_mem_t* mem,
+    const bfg_cell_t* addr,
+    bfg_cell_t dst
+) {
+    bfg_cell_t restore = mem->tmp[0];
+    int leaf = bfg_new_anchor(g);
+
+    bfg_comment(g, "mem load");
+    bfg_clear(g, dst);
+    mem_open_page(g, mem, addr);
+    mem_lay_trail(g, mem, 0, addr[0]);
+
+    // carry the byte out unit by unit and count it in restore
+    mem_enter_data(g, mem, leaf);
+    bfg_loop(g);
+    bfg_add_here(g, -1);
+    mem_leave_data(g, mem);
+    bfg_add(g, dst, 1);
+    bfg_add(g, restore, 1);
+    mem_enter_data(g, mem, leaf);
+    bfg_end(g);
+    mem_leave_data(g, mem);
+
+    bfg_while(g, restore);
+    bfg_add_here(g, -1);
+    mem_enter_data(g, mem, leaf);
+    bfg_add_here(g, 1);
+    mem_leave_data(g, mem);
+    bfg_end_at(g, restore);
+
+    mem_close_page(g, mem);
+}
+
+void bfg_mem_store(
+    bfg_t* g,
+    const bfg_mem_t* mem,
+    const bfg_cell_t* addr,
+    bfg_cell_t src
+) {
+    int leaf = bfg_new_anchor(g);
+
+    bfg_comment(g, "mem store");
+    mem_open_page(g, mem, addr);
+    mem_lay_trail(g, mem, 0, addr[0]);
+
+    mem_enter_data(g, mem, leaf);
+    bfg_clear_here(g);
+    mem_leave_data(g, mem);
+
+    bfg_while(g, src);
+    bfg_add_here(g, -1);
+    mem_enter_data(g, mem, leaf);
+    bfg_add_here(g, 1);
+    mem_leave_data(g, mem);
+    bfg_end_at(g, src);
+
+    mem_close_page(g, mem);
+}
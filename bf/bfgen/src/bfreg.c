@@ -0,0 +1,176 @@
+#include <bfreg.h>
+
+bool bfg_regs_init(bfg_regs_t* ra, const bfg_alu_t* alu, int first, int count) {
+    if (first < BFG_ALU_USER || count < 1 || count > BFG_REGS_MAX || first + count > alu->registers)
+        return false;
+
+    ra->alu = alu;
+    ra->first = first;
+    ra->count = count;
+    ra->clock = 0;
+    ra->loads = 0;
+    ra->stores = 0;
+    ra->restores = 0;
+    for (int i = 0; i < count; i++)
+        ra->slots[i].frame = BFG_NO_CELL;
+    return true;
+}
+
+static bfg_cell_t regs_cell(const bfg_regs_t* ra, int i) {
+    return bfg_alu_reg(ra->alu, ra->first + i);
+}
+
+static int regs_find(const bfg_regs_t* ra, bfg_cell_t frame) {
+    for (int i = 0; i < ra->count; i++) {
+        if (ra->slots[i].frame == frame)
+            return i;
+    }
+    return -1;
+}
+
+/// Moves the local of register i back to the frame; the register becomes zero
+static void regs_store(bfg_t* g, bfg_regs_t* ra, int i) {
+    bfg_reg_slot_t* s = &ra->slots[i];
+    bfg_cell_t reg = regs_cell(ra, i);
+
+    for (int k = 0; k < s->n; k++) {
+        if (s->stale)
+            bfg_clear(g, s->frame + k);
+        bfg_move(g, reg + k, s->frame + k);
+    }
+    s->frame = BFG_NO_CELL;
+    ra->stores++;
+}
+
+/// A free register for the local, writing back the least recently used one
+static int regs_take(bfg_t* g, bfg_regs_t* ra, bfg_cell_t frame, int n) {
+    const bfg_alu_t* alu = ra->alu;
+    int victim = 0;
+
+    if (n < 1 || n > alu->width) {
+        bfg_fail(g, "local wider than a register");
+        return -1;
+    }
+    if (frame + n > alu->base && frame < alu->base + bfg_alu_cells(alu)) {
+        bfg_fail(g, "local inside the register area");
+        return -1;
+    }
+    for (int i = 0; i < ra->count; i++) {
+        if (ra->slots[i].frame == BFG_NO_CELL) {
+            victim = i;
+            break;
+        }
+        if (ra->slots[i].used < ra->slots[victim].used)
+            victim = i;
+    }
+    if (ra->slots[victim].frame != BFG_NO_CELL)
+        regs_store(g, ra, victim);
+
+    ra->slots[victim].frame = frame;
+    ra->slots[victim].n = n;
+    return victim;
+}
+
+bfg_cell_t bfg_regs_use(bfg_t* g, bfg_regs_t* ra, bfg_cell_t frame, int n) {
+    int i = regs_find(ra, frame);
+
+    if (i < 0) {
+        i = regs_take(g, ra, frame, n);
+        if (i < 0)
+            return regs_cell(ra, 0);
+        for (int k = 0; k < n; k++)
+            bfg_move(g, frame + k, regs_cell(ra, i) + k);
+        ra->slots[i].stale = false;
+        ra->loads++;
+    }
+    ra->slots[i].used = ++ra->clock;
+    return regs_cell(ra, i);
+}
+
+bfg_cell_t bfg_regs_def(bfg_t* g, bfg_regs_t* ra, bfg_cell_t frame, int n) {
+    int i = regs_find(ra, frame);
+
+    if (i >= 0) {
+        bfg_int_clear(g, ra->alu, regs_cell(ra, i), ra->slots[i].n);
+    } else {
+        i = regs_take(g, ra, frame, n);
+        if (i < 0)
+            return regs_cell(ra, 0);
+        ra->slots[i].stale = true;
+    }
+    ra->slots[i].used = ++ra->clock;
+    return regs_cell(ra, i);
+}
+
+void bfg_regs_kill(bfg_t* g, bfg_regs_t* ra, bfg_cell_t frame) {
+    int i = regs_find(ra, frame);
+
+    if (i < 0)
+        return;
+    bfg_int_clear(g, ra->alu, regs_cell(ra, i), ra->slots[i].n);
+    ra->slots[i].frame = BFG_NO_CELL;
+}
+
+void bfg_regs_copy(
+    bfg_t* g,
+    bfg_regs_t* ra,
+    bfg_cell_t frame,
+    int n,
+    const bfg_cell_t* dst,
+    int count,
+    bool dead
+) {
+    bfg_cell_t targets[BFG_REGS_MAX + 1];
+    bfg_cell_t src = bfg_regs_use(g, ra, frame, n);
+    int i = regs_find(ra, frame);
+    int home = -1;
+
+    if (i < 0 || count < 0 || count > BFG_REGS_MAX) {
+        bfg_fail(g, "bad register copy");
+        return;
+    }
+    for (int j = 0; j < count; j++) {
+        if (dst[j] == src) {
+            bfg_fail(g, "register copied onto itself");
+            return;
+        }
+        bfg_int_clear(g, ra->alu, dst[j], n);
+    }
+    if (!dead) {
+        for (int j = 0; j < ra->count && home < 0; j++) {
+            if (ra->slots[j].frame == BFG_NO_CELL)
+                home = j;
+        }
+    }
+
+    for (int k = 0; k < n; k++) {
+        for (int j = 0; j < count; j++)
+            targets[j] = dst[j] + k;
+        if (dead) {
+            bfg_transfer(g, src + k, (size_t) count, targets, NULL);
+        } else if (home >= 0) {
+            targets[count] = regs_cell(ra, home) + k;
+            bfg_transfer(g, src + k, (size_t) count + 1, targets, NULL);
+        } else {
+            targets[count] = bfg_alu_reg(ra->alu, BFG_ALU_TMP) + k;
+            bfg_transfer(g, src + k, (size_t) count + 1, targets, NULL);
+            bfg_move(g, targets[count], src + k);
+        }
+    }
+
+    if (dead) {
+        ra->slots[i].frame = BFG_NO_CELL;
+    } else if (home >= 0) {
+        ra->slots[home] = ra->slots[i];
+        ra->slots[i].frame = BFG_NO_CELL;
+    } else {
+        ra->restores++;
+    }
+}
+
+void bfg_regs_flush(bfg_t* g, bfg_regs_t* ra) {
+    for (int i = 0; i < ra->count; i++) {
+        if (ra->slots[i].frame != BFG_NO_CELL)
+            regs_store(g, ra, i);
+    }
+}
@@ -0,0 +1,265 @@
+#include <bfvm.h>
+#include <stdlib.h>
+#include <string.h>
+
+DECL_VEC(size_t);
+
+bool bfvm_init(bfvm_t* vm, size_t tape_size) {
+    VEC_TYPE(bfvm_inst_t) program = VEC_INIT();
+    VEC_TYPE(char) output = VEC_INIT();
+
+    vm->program = program;
+    vm->output = output;
+    vm->tape = calloc(tape_size, 1);
+    vm->tape_size = tape_size;
+    vm->dp = 0;
+    vm->input = "";
+    vm->stats.ops = 0;
+    vm->stats.commands = 0;
+    return vm->tape != NULL;
+}
+
+void bfvm_free(bfvm_t* vm) {
+    VEC_FREE(vm->program);
+    VEC_FREE(vm->output);
+    free(vm->tape);
+    vm->tape = NULL;
+}
+
+static bool bfvm_push(bfvm_t* vm, bfvm_op_t op, long arg) {
+    bfvm_inst_t inst = { .op = op, .arg = arg, .jump = 0, .width = 1, .cells = 0 };
+    bool res;
+
+    VEC_PUSH(vm->program, inst, res);
+    return res;
+}
+
+/// Distance of the transfer loop [-{d}+{-d}] at pc, 0 if there is none
+static long bfvm_transfer_at(const bfvm_inst_t* program, size_t length, size_t pc) {
+    if (pc + 5 >= length || program[pc].op != BFVM_OPEN || program[pc].jump != pc + 5)
+        return 0;
+    if (program[pc + 1].op != BFVM_ADD || program[pc + 1].arg != -1
+            || program[pc + 2].op != BFVM_MOVE || program[pc + 3].op != BFVM_ADD
+            || program[pc + 3].arg != 1 || program[pc + 4].op != BFVM_MOVE
+            || program[pc + 4].arg != -program[pc + 2].arg)
+        return 0;
+    return program[pc + 2].arg;
+}
+
+/// Folds runs of at least two transfer loops, one cell apart, into blocks
+static void bfvm_find_blocks(bfvm_t* vm) {
+    bfvm_inst_t* program = vm->program.data;
+    size_t length = vm->program.length;
+
+    for (size_t pc = 0; pc < length; pc++) {
+        long distance = bfvm_transfer_at(program, length, pc);
+        size_t last = pc + 5;
+        size_t cells = 1;
+
+        if (distance == 0)
+            continue;
+        while (last + 1 < length && program[last + 1].op == BFVM_MOVE && program[last + 1].arg == 1
+                && bfvm_transfer_at(program, length, last + 2) == distance) {
+            last += 7;
+            cells++;
+        }
+        if (cells < 2)
+            continue;
+        program[pc].op = BFVM_BLOCK;
+        program[pc].arg = distance;
+        program[pc].jump = last;
+        program[pc].cells = cells;
+        pc = last;
+    }
+}
+
+bfvm_status_t bfvm_load(bfvm_t* vm, const char* code) {
+    VEC_TYPE(size_t) stack = VEC_INIT();
+    bfvm_status_t status = BFVM_OK;
+    bool res = true;
+
+    VEC_CLEAR(vm->program);
+    VEC_CLEAR(vm->output);
+    memset(vm->tape, 0, vm->tape_size);
+    vm->dp = 0;
+    vm->stats.ops = 0;
+    vm->stats.commands = 0;
+
+    for (const char* c = code; *c && status == BFVM_OK; c++) {
+        bfvm_op_t op;
+        long arg = 0;
+
+        switch (*c) {
+            case '+': op = BFVM_ADD; arg = 1; break;
+            case '-': op = BFVM_ADD; arg = -1; break;
+            case '>': op = BFVM_MOVE; arg = 1; break;
+            case '<': op = BFVM_MOVE; arg = -1; break;
+            case '[': op = BFVM_OPEN; break;
+            case ']': op = BFVM_CLOSE; break;
+            case '.': op = BFVM_WRITE; break;
+            case ',': op = BFVM_READ; break;
+            default: continue;
+        }
+
+        size_t length = vm->program.length;
+        if ((op == BFVM_ADD || op == BFVM_MOVE) && length > 0
+                && vm->program.data[length - 1].op == op) {
+            vm->program.data[length - 1].arg += arg;
+            vm->program.data[length - 1].width++;
+            continue;
+        }
+
+        if (!bfvm_push(vm, op, arg)) {
+            status = BFVM_ERR_MEMORY;
+            break;
+        }
+
+        if (op == BFVM_OPEN) {
+            VEC_PUSH(stack, length, res);
+            if (!res)
+                status = BFVM_ERR_MEMORY;
+        } else if (op == BFVM_CLOSE) {
+            size_t open;
+            VEC_POP(stack, open, res);
+            if (!res) {
+                status = BFVM_ERR_SYNTAX;
+                break;
+            }
+            vm->program.data[open].jump = length;
+            vm->program.data[length].jump = open;
+
+            // [>>>] and [<<] become a single scan op
+            if (open + 2 == length && vm->program.data[open + 1].op == BFVM_MOVE
+                    && vm->program.data[open + 1].arg != 0) {
+                vm->program.data[open].op = BFVM_SCAN;
+                vm->program.data[open].arg = vm->program.data[open + 1].arg;
+            }
+        }
+    }
+
+    if (status == BFVM_OK && stack.length != 0)
+        status = BFVM_ERR_SYNTAX;
+    if (status == BFVM_OK)
+        bfvm_find_blocks(vm);
+    VEC_FREE(stack);
+    return status;
+}
+
+bfvm_status_t bfvm_run(bfvm_t* vm, uint64_t max_ops) {
+    bfvm_inst_t* program = vm->program.data;
+    size_t length = vm->program.length;
+    uint8_t* tape = vm->tape;
+    size_t dp = vm->dp;
+    bfvm_status_t status = BFVM_OK;
+    bool res;
+
+    for (size_t pc = 0; pc < length; pc++) {
+        bfvm_inst_t* inst = &program[pc];
+
+        if (max_ops && vm->stats.ops >= max_ops) {
+            status = BFVM_ERR_LIMIT;
+            break;
+        }
+        vm->stats.ops++;
+
+        switch (inst->op) {
+            case BFVM_ADD:
+                tape[dp] += (uint8_t) inst->arg;
+                vm->stats.commands += (uint64_t) inst->width;
+                break;
+            case BFVM_MOVE:
+                if ((inst->arg < 0 && (size_t) -inst->arg > dp)
+                        || (inst->arg > 0 && (size_t) inst->arg >= vm->tape_size - dp)) {
+                    status = BFVM_ERR_TAPE;
+                    goto done;
+                }
+                dp += (size_t) inst->arg;
+                vm->stats.commands += (uint64_t) inst->width;
+                break;
+            case BFVM_OPEN:
+                vm->stats.commands++;
+                if (!tape[dp])
+                    pc = inst->jump;
+                break;
+            case BFVM_CLOSE:
+                vm->stats.commands++;
+                if (tape[dp])
+                    pc = inst->jump;
+                break;
+            case BFVM_SCAN:
+                vm->stats.commands++;
+                while (tape[dp]) {
+                    if ((inst->arg < 0 && (size_t) -inst->arg > dp)
+                            || (inst->arg > 0 && (size_t) inst->arg >= vm->tape_size - dp)) {
+                        status = BFVM_ERR_TAPE;
+                        goto done;
+                    }
+                    dp += (size_t) inst->arg;
+                    vm->stats.commands += (uint64_t) program[pc + 1].width + 1;
+                }
+                pc = inst->jump;
+                break;
+            case BFVM_BLOCK: {
+                long distance = inst->arg < 0 ? -inst->arg : inst->arg;
+                size_t last = dp + inst->cells - 1;
+
+                if ((inst->arg < 0 && (size_t) distance > dp)
+                        || last + (inst->arg > 0 ? (size_t) distance : 0) >= vm->tape_size) {
+                    status = BFVM_ERR_TAPE;
+                    goto done;
+                }
+                for (size_t i = 0; i < inst->cells; i++) {
+                    uint8_t value = tape[dp + i];
+
+                    tape[dp + i + inst->arg] += value;
+                    tape[dp + i] = 0;
+                    // '[', value rounds of "-{d}+{d}]" and the '>' to the next cell
+                    vm->stats.commands += 1 + (uint64_t) value * (2 * (uint64_t) distance + 3)
+                        + (i + 1 < inst->cells);
+                }
+                dp = last;
+                pc = inst->jump;
+                break;
+            }
+            case BFVM_WRITE:
+                vm->stats.commands++;
+                VEC_PUSH(vm->output, (char) tape[dp], res);
+                if (!res) {
+                    status = BFVM_ERR_MEMORY;
+                    goto done;
+                }
+                break;
+            case BFVM_READ:
+                vm->stats.commands++;
+                tape[dp] = (uint8_t) *vm->input;
+                if (*vm->input)
+                    vm->input++;
+                break;
+        }
+    }
+
+done:
+    vm->dp = dp;
+    return status;
+}
+
+const char* bfvm_output(bfvm_t* vm) {
+    bool res;
+
+    VEC_PUSH(vm->output, 0, res);
+    if (!res)
+        return "";
+    vm->output.length--;
+    return vm->output.data;
+}
+
+const char* bfvm_status_name(bfvm_status_t status) {
+    switch (status) {
+        case BFVM_OK: return "ok";
+        case BFVM_ERR_SYNTAX: return "unmatched bracket";
+        case BFVM_ERR_TAPE: return "head left the tape";
+        case BFVM_ERR_LIMIT: return "op limit reached";
+        case BFVM_ERR_MEMORY: return "out of memory";
+    }
+    return "unknown";
+}
@@ -0,0 +1,139 @@
+#include <bfgen.h>
+#include <bfgen_bench.h>
+#include <bfgen_run.h>
+#include <bfgen_tests.h>
+#include <bfimage.h>
+#include <bfmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void usage(void) {
+    printf(
+        "usage: bfgen test\n"
+        "       bfgen bench\n"
+        "       bfgen [-m <map>] [-i <dir>] mem <levels> <fanout> [cached]\n"
+        "       bfgen [-m <map>] [-i <dir>] run mem <levels> <fanout> [cached]\n"
+        "-m writes the source map of the program (see bfg_write_map)\n"
+        "-i preloads the data as a tape image in <dir> (see bfg_image_write)\n"
+    );
+}
+
+static bool write_map(bfg_t* g, const char* filename) {
+    FILE* f = fopen(filename, "w");
+    bool ok = f != NULL && bfg_write_map(g, f);
+
+    if (f != NULL && fclose(f) != 0)
+        ok = false;
+    if (!ok)
+        fprintf(stderr, "cannot write %s\n", filename);
+    return ok;
+}
+
+typedef struct demo_options {
+    /// Run the program in ibf instead of printing it
+    bool run;
+    /// Source map file or NULL
+    const char* map;
+    /// Directory of the tape image or NULL
+    const char* image;
+} demo_options_t;
+
+/// Emits a program that scatters a message over the tree memory and reads it
+/// back. With an image the message is preloaded instead of stored.
+static int emit_mem_demo(int levels, int fanout, bool cached, const demo_options_t* options) {
+    static const char message[] = "Hello from the tree memory!\n";
+    enum { FRAME = 0, ADDR = BFG_MEM_FRAME_CELLS, VALUE = ADDR + BFG_MEM_MAX_LEVELS };
+    bfg_cell_t addr[BFG_MEM_MAX_LEVELS];
+    bfg_image_t image;
+    bfg_mem_t mem;
+    bfg_t g;
+
+    if (!bfg_mem_init(&mem, levels, fanout, cached, VALUE + 1, FRAME)) {
+        fprintf(stderr, "bad memory parameters\n");
+        return 1;
+    }
+    for (int k = 0; k < levels; k++)
+        addr[k] = ADDR + k;
+
+    bfg_init(&g);
+    bfg_image_init(&image);
+    bfg_comment(&g, "Tree memory demo: generated by bfgen; see bf/bfgen/README.md");
+    for (int pass = options->image != NULL; pass < 2; pass++) {
+        for (size_t i = 0; i < sizeof(message) - 1; i++) {
+            unsigned long a = (i * 7919ul) % bfg_mem_capacity(&mem);
+            if (options->image != NULL && pass == 1)
+                bfg_image_preload(&image, &mem, a, &message[i], 1);
+            BFG_LOCATE(&g);
+            for (int k = 0; k < levels; k++) {
+                bfg_set(&g, addr[k], (int) (a % (unsigned long) fanout));
+                a /= (unsigned long) fanout;
+            }
+            if (pass == 0) {
+                BFG_LOCATE(&g);
+                bfg_set(&g, VALUE, message[i]);
+                BFG_LOCATE(&g);
+                bfg_mem_store(&g, &mem, addr, VALUE);
+            } else {
+                BFG_LOCATE(&g);
+                bfg_mem_load(&g, &mem, addr, VALUE);
+                BFG_LOCATE(&g);
+                bfg_output(&g, VALUE);
+            }
+        }
+    }
+
+    bool ok = g.error == NULL;
+    if (!ok)
+        fprintf(stderr, "generation failed: %s\n", g.error);
+    if (ok && options->map != NULL)
+        ok = write_map(&g, options->map);
+    if (ok && options->image != NULL) {
+        ok = bfg_image_write(&image, options->image);
+        if (!ok)
+            fprintf(stderr, "cannot write the image to %s\n", options->image);
+    }
+    if (ok && options->run) {
+        ok = bfg_run(bfg_code(&g), options->image);
+    } else if (ok) {
+        fputs(bfg_code(&g), stdout);
+        putchar('\n');
+    }
+    bfg_image_free(&image);
+    bfg_free(&g);
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    demo_options_t options = { false, NULL, NULL };
+
+    while (argc >= 3 && (strcmp(argv[1], "-m") == 0 || strcmp(argv[1], "-i") == 0)) {
+        if (argv[1][1] == 'm')
+            options.map = argv[2];
+        else
+            options.image = argv[2];
+        argc -= 2;
+        argv += 2;
+    }
+
+    bool run = argc >= 2 && strcmp(argv[1], "run") == 0;
+
+    if (run) {
+        options.run = true;
+        argc--;
+        argv++;
+    }
+    if (!run && argc >= 2 && strcmp(argv[1], "test") == 0) {
+        run_bfgen_tests();
+        run_bfint_tests();
+        return 0;
+    }
+    if (!run && argc >= 2 && strcmp(argv[1], "bench") == 0)
+        return run_bfint_bench();
+    if (argc >= 4 && strcmp(argv[1], "mem") == 0) {
+        bool cached = argc >= 5 && strcmp(argv[4], "cached") == 0;
+        return emit_mem_demo(atoi(argv[2]), atoi(argv[3]), cached, &options);
+    }
+    usage();
+    return 1;
+}
@@ -56,16 +56,22 @@ void debugger_print_instruction(char inst[]) {
 
         switch (cmd) {
                 case '+':
-                        printf("+ % 3d", (unsigned int)arg + 1);
+                        printf("+ % 3d", (unsigned char)arg + 1);
                         break;
                 case '-':
-                        printf("- % 3d", (unsigned int)arg + 1);
+                        printf("- % 3d", (unsigned char)arg + 1);
                         break;
                 case '>':
-                        printf("> % 3d", (unsigned int)arg + 1);
+                        printf("> % 3d", (unsigned char)arg + 1);
                         break;
                 case '<':
-                        printf("< % 3d", (unsigned int)arg + 1);
+                        printf("< % 3d", (unsigned char)arg + 1);
+                        break;
+                case '}':
+                        printf("[>]");
+                        break;
+                case '{':
+                        printf("[<]");
                         break;
                 case '[':
                         printf("[");
@@ -90,6 +96,10 @@ void debugger_call(char reason, CELL tape[], short program[], unsigned long dp,
         if (reason == BREAK_REASON_INSTRUCTION && !debugger_stepper) return;
 
         printf("program: 0x%x\n", pc);
+        struct map_entry *location = source_map_find(pc);
+        if (location) {
+                printf("at %s in %s\n", location->location, location->function);
+        }
         for (int offset = -2; offset < 5; offset++) {
                 if ((-offset) <= pc || offset >= 0) {
                         if (!offset) {
@@ -1,8 +1,20 @@
 #include "config.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #define HOT_TAPE (PAGE_SIZE * 4)
+#define PAGE_BYTES ((unsigned long)PAGE_SIZE * (sizeof (CELL)))
+
+/* A page file holds the first cells of its page, the rest are zero. Pages
+ * are stored without their trailing zeros, so an image written by bld or
+ * bfgen (bfg_image_write) is only as big as its data. */
 
 void load_page(CELL *tape, unsigned long page_uid);
+int read_page(CELL *tape, unsigned long page_uid);
 void store_page(CELL *tape, unsigned long page_uid);
 
 unsigned long get_page_uid(unsigned long dp) {
@@ -33,33 +45,101 @@ void perform_page_switch(CELL tape[], signed char expected_direction, unsigned l
         load_page(tape, current_page_uid + expected_direction);
 }
 
+/* The hot tape. Where there is mmap, a page is brought in by mapping its
+ * file privately over its slot: nothing is read until the program touches
+ * it, so preloaded data costs nothing at startup. */
+CELL *allocate_tape() {
+#ifdef _WIN32
+        CELL *tape = calloc(HOT_TAPE, sizeof (CELL));
+        if (!tape) {
+#else
+        CELL *tape = mmap(0, HOT_TAPE * (sizeof (CELL)), PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (tape == MAP_FAILED) {
+#endif
+                printf("memory allocation failed\n");
+                exit(1);
+        }
+        return tape;
+}
+
+void free_tape(CELL tape[]) {
+#ifdef _WIN32
+        free(tape);
+#else
+        munmap(tape, HOT_TAPE * (sizeof (CELL)));
+#endif
+}
+
+/* Zeroes the slot from the given byte on */
+void clear_slot(CELL tape[], char page_n, unsigned long from) {
+        char *slot = (char *)&tape[PAGE_SIZE*page_n];
+#ifdef _WIN32
+        memset(slot + from, 0, PAGE_BYTES - from);
+#else
+        /* fresh anonymous pages instead of writing zeros over 256 MB */
+        long os_page = sysconf(_SC_PAGESIZE);
+        unsigned long mapped = (from + os_page - 1) / os_page * os_page;
+
+        memset(slot + from, 0, (mapped < PAGE_BYTES ? mapped : PAGE_BYTES) - from);
+        if (mapped < PAGE_BYTES &&
+            mmap(slot + mapped, PAGE_BYTES - mapped, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED) {
+                printf("page clear failed!\n");
+                exit(1);
+        }
+#endif
+}
+
 void store_page(CELL tape[], unsigned long page_uid) {
         char page_n = page_uid % 4;
-        CELL *target = &tape[PAGE_SIZE*page_n];
+        char *target = (char *)&tape[PAGE_SIZE*page_n];
+        unsigned long size = PAGE_BYTES;
 
-        char filename[17];
+        while (size && !target[size - 1]) {
+                size--;
+        }
+
+        char filename[17], temp[21];
         sprintf(filename, "%016lx", page_uid);
+        /* the slot may be a mapping of the file: write a new file and
+         * rename it over the old one rather than truncating it */
+        sprintf(temp, "%s.new", filename);
 #ifdef DEBUG
         printf("storing page: 0x%s... ", filename);
 #endif
 
-	FILE *f = fopen(filename, "wb");
+	FILE *f = fopen(temp, "wb");
         if (!f) {
                 printf("page store failed! (open)\n");
                 exit(1);
         }
 
-	if (fwrite(target, 1, PAGE_SIZE, f) < PAGE_SIZE) {
+	if (fwrite(target, 1, size, f) < size) {
                 printf("page store failed! (write)\n");
                 exit(1);
         }
+        fclose(f);
+#ifdef _WIN32
+        remove(filename);
+#endif
+        if (rename(temp, filename)) {
+                printf("page store failed! (rename)\n");
+                exit(1);
+        }
 #ifdef DEBUG
         printf("ok\n");
 #endif
-        fclose(f);
 }
 
 void load_page(CELL tape[], unsigned long page_uid) {
+        if (!read_page(tape, page_uid)) {
+                clear_slot(tape, page_uid % 4, 0);
+        }
+}
+
+/* Loads a stored page, returns 0 and leaves the slot alone if there is none */
+int read_page(CELL tape[], unsigned long page_uid) {
         char page_n = page_uid % 4;
         CELL *target = &tape[PAGE_SIZE*page_n];
 
@@ -69,21 +149,43 @@ void load_page(CELL tape[], unsigned long page_uid) {
         printf("loading page: 0x%s... ", filename);
 #endif
 
+#ifdef _WIN32
 	FILE *f = fopen(filename, "rb");
         if (!f) {
-                memset(target, 0, PAGE_SIZE);
 #ifdef DEBUG
                 printf("empty\n");
 #endif
-                return;
+                return 0;
+        }
+
+        unsigned long size = fread(target, 1, PAGE_BYTES, f);
+        if (ferror(f)) {
+                printf("page load failed!\n");
+                exit(1);
+        }
+        fclose(f);
+#else
+        int fd = open(filename, O_RDONLY);
+        struct stat st;
+        if (fd < 0) {
+#ifdef DEBUG
+                printf("empty\n");
+#endif
+                return 0;
         }
 
-	if (fread(target, 1, PAGE_SIZE, f) < PAGE_SIZE) {
+        if (fstat(fd, &st) || (unsigned long)st.st_size > PAGE_BYTES ||
+            (st.st_size && mmap(target, st.st_size, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)) {
                 printf("page load failed!\n");
                 exit(1);
         }
+        close(fd);
+        unsigned long size = st.st_size;
+#endif
+        clear_slot(tape, page_n, size);
 #ifdef DEBUG
         printf("ok\n");
 #endif
-        fclose(f);
+        return 1;
 }
@@ -13,21 +13,39 @@
 #include "optimizer.c"
 #include "infinite-tape.c"
 
+#if defined(DEBUGGER) || defined(PROFILER)
+#include "source-map.c"
+#define OP_OFFSETS (&op_offsets)
+#else
+#define OP_OFFSETS 0
+#endif
+
 #ifdef DEBUGGER
 #include "debugger.c"
 #endif
 
+#ifdef PROFILER
+#include "profiler.c"
+#endif
+
 #include "config.h"
 
 char* read_file(char* filename, unsigned long *program_length);
+int ibf_run(const char *code, unsigned long code_length);
 int find_loops(short *program, unsigned long *loops);
+void find_scans(short *program, unsigned long *loops);
+void find_blocks(short *program, unsigned long *loops);
 void evaluate(short *program, CELL *tape, unsigned long *loops);
 
+/* Built with IBF_LIBRARY, this file is the evaluator alone: a program that
+ * generates BF (bfgen run) includes it and calls ibf_run() on the code it
+ * holds in memory. */
+#ifndef IBF_LIBRARY
 int main(int argc, char *argv[]) {
 	char *filename;
 
 	if (argc > 2) {
-		printf("usage: %s <program>\n", argv[0]);
+		printf("usage: %s <program>|-\n", argv[0]);
 		return 1;
 	} else if (argc == 2) {
 		filename = argv[1];
@@ -37,36 +55,71 @@ int main(int argc, char *argv[]) {
 	
 	unsigned long program_length;
 	char *program_raw = (char*) read_file(filename, &program_length);
-        short *program = optimize(program_raw);
+#if defined(DEBUGGER) || defined(PROFILER)
+	source_map_load(source_map_name(filename));
+#endif
+	int ret = ibf_run(program_raw, program_length);
+	free(program_raw);
+	return ret;
+}
+#endif
+
+int ibf_run(const char *code, unsigned long code_length) {
+        short *program = optimize(code, OP_OFFSETS);
 
-	unsigned long *loops = safe_malloc(program_length * (sizeof (unsigned long)));
+	unsigned long *loops = safe_malloc((code_length + 2) * (sizeof (unsigned long)));
 	if (find_loops(program, loops)) {
+                free(loops);
+                free(program);
                 return 1;
         }
+        find_scans(program, loops);
+        find_blocks(program, loops);
 
-	CELL *tape = safe_malloc(HOT_TAPE * (sizeof (CELL)));
-	memset(tape, 0, HOT_TAPE * (sizeof (CELL)));
+	/* the tape is zero without being touched: only stored pages are
+	 * mapped in, a program that stays near the start costs no more */
+	CELL *tape = allocate_tape();
 
-	load_page(tape, -1);
-	load_page(tape, 0);
-	load_page(tape, 1);
+	read_page(tape, -1);
+	read_page(tape, 0);
+	read_page(tape, 1);
 
+#ifdef PROFILER
+        profiler_init(code_length + 2);
+#endif
         evaluate(program, tape, loops);
+        fflush(stdout);
+#ifdef PROFILER
+        profiler_report(program);
+#endif
+
+        free_tape(tape);
+        free(loops);
+        free(program);
+        return 0;
 }
 
 int find_loops(short program[], unsigned long loops[]) {
 	unsigned long ind = -1;
-	char sp = 0;
-	unsigned long stack[256];
+	/* nesting is only bounded by the program: generated code (bfgen
+	 * switches) goes deeper than any fixed stack would */
+	size_t sp = 0;
+	size_t stack_size = 256;
+	unsigned long *stack = safe_malloc(stack_size * sizeof (unsigned long));
 	char inst;
 
 	while ((inst = program[++ind])) {
 		if (inst == '[') {
+			if (sp == stack_size) {
+				stack_size *= 2;
+				stack = safe_realloc(stack, stack_size * sizeof (unsigned long));
+			}
 			stack[sp++] = ind;
 		}
 		else if (inst == ']') {
                         if (sp == 0) {
                                 puts("loop stack underflow\n");
+                                free(stack);
                                 return 1;
                         }
 			sp--;
@@ -74,6 +127,7 @@ int find_loops(short program[], unsigned long loops[]) {
 			loops[stack[sp]] = ind;
 		}
 	}
+        free(stack);
         if (sp > 0) {
                 puts("loop stack overflow\n");
                 return 1;
@@ -81,6 +135,96 @@ int find_loops(short program[], unsigned long loops[]) {
         return 0;
 }
 
+/* Turns pure scan loops ([>>>], [<<]) into a single '}' or '{' op.
+ * loops[pc] of the scan holds the stride, loops[pc+1] the closing bracket.
+ * These are the glides the bfgen memory model walks (bf/bfgen/README.md). */
+void find_scans(short program[], unsigned long loops[]) {
+	unsigned long ind = -1;
+	char inst;
+
+	while ((inst = program[++ind])) {
+		if (inst != '[')
+			continue;
+
+		unsigned long end = loops[ind];
+		char dir = program[ind + 1];
+		unsigned long stride = 0;
+		unsigned long i;
+
+		if (dir != '>' && dir != '<')
+			continue;
+		for (i = ind + 1; i < end && (char)program[i] == dir; i++)
+			stride += (unsigned char)(program[i] >> 8) + 1;
+		if (i != end)
+			continue;
+
+		program[ind] = (program[ind] & 0xff00) | (dir == '>' ? '}' : '{');
+		loops[ind] = stride;
+		loops[ind + 1] = end;
+		ind = end;
+	}
+}
+
+/* Distance of the transfer loop [-{d}+{-d}] at ind (d > 0 is right),
+ * 0 if there is none. */
+long transfer_at(short program[], unsigned long loops[], unsigned long ind) {
+	unsigned long end, i;
+	long right = 0, left = 0;
+	char dir, back;
+
+	if ((char)program[ind] != '[')
+		return 0;
+	end = loops[ind];
+	i = ind + 1;
+	if ((char)program[i] != '-' || (unsigned char)(program[i] >> 8) != 0)
+		return 0;
+	dir = program[++i];
+	if (dir != '>' && dir != '<')
+		return 0;
+	back = dir == '>' ? '<' : '>';
+	for (; i < end && (char)program[i] == dir; i++)
+		right += (unsigned char)(program[i] >> 8) + 1;
+	if (i == end || (char)program[i] != '+' || (unsigned char)(program[i] >> 8) != 0)
+		return 0;
+	for (i++; i < end && (char)program[i] == back; i++)
+		left += (unsigned char)(program[i] >> 8) + 1;
+	if (i != end || left != right)
+		return 0;
+	return dir == '>' ? right : -right;
+}
+
+/* Turns runs of transfer loops one cell apart, [->>+<<]>[->>+<<]>...,
+ * into a single '=' op that moves the whole block (bfg_move_block).
+ * loops[pc] holds the distance, loops[pc+1] the last closing bracket and
+ * loops[pc+2] the number of cells. The cells it touches stay within the
+ * pages around the head, which are always loaded. */
+void find_blocks(short program[], unsigned long loops[]) {
+	unsigned long ind = -1;
+	char inst;
+
+	while ((inst = program[++ind])) {
+		long distance = transfer_at(program, loops, ind);
+		unsigned long last, cells = 1;
+
+		if (distance == 0)
+			continue;
+		last = loops[ind];
+		while ((char)program[last + 1] == '>' && (unsigned char)(program[last + 1] >> 8) == 0
+		       && transfer_at(program, loops, last + 2) == distance) {
+			last = loops[last + 2];
+			cells++;
+		}
+		if (cells < 2 || cells + labs(distance) >= PAGE_SIZE)
+			continue;
+
+		program[ind] = (program[ind] & 0xff00) | '=';
+		loops[ind] = (unsigned long)distance;
+		loops[ind + 1] = last;
+		loops[ind + 2] = cells;
+		ind = last;
+	}
+}
+
 union command {
         struct {
                 char cmd;
@@ -112,23 +256,34 @@ void evaluate(short program[], CELL tape[], unsigned long loops[]) {
 	jumptable['.'] = &&output;
 	jumptable['['] = &&loopstart;
 	jumptable[']'] = &&loopend;
+	jumptable['}'] = &&scanright;
+	jumptable['{'] = &&scanleft;
+	jumptable['='] = &&block;
 #ifdef DEBUGGER
 	jumptable['#'] = &&breakinst;
 #endif
 
+#ifdef PROFILER
+#define PROFILE_OP profile_counts[pc]++;
+#else
+#define PROFILE_OP
+#endif
+
 #ifdef DEBUGGER
 
 #define NEXT \
 	inst.raw = program[++pc]; \
+	PROFILE_OP \
         if (inst.d.cmd != '#') \
                 debugger_call(BREAK_REASON_INSTRUCTION, tape, program, dp, pc); \
-	goto *(jumptable[inst.d.cmd]);
+	goto *(jumptable[(unsigned char)inst.d.cmd]);
 
 #else
 
 #define NEXT \
 	inst.raw = program[++pc]; \
-	goto *(jumptable[inst.d.cmd]);
+	PROFILE_OP \
+	goto *(jumptable[(unsigned char)inst.d.cmd]);
 
 #endif
 
@@ -136,24 +291,54 @@ ignore:
 	NEXT
 
 plus:
-	tape[dp%HOT_TAPE]+=(short)inst.d.arg + 1;
+	tape[dp%HOT_TAPE]+=(unsigned char)inst.d.arg + 1;
 	NEXT
 
 minus:
-	tape[dp%HOT_TAPE]-=(short)inst.d.arg + 1;
+	tape[dp%HOT_TAPE]-=(unsigned char)inst.d.arg + 1;
 	NEXT
 
 
 right:
-	dp+=((unsigned long)inst.d.arg) + 1;
+	dp+=(unsigned char)inst.d.arg + 1;
 	CHECK_PAGE_TRANSITION(tape, 1, dp, last_page);
 	NEXT
 
 left:
-	dp-=(short)inst.d.arg + 1;
+	dp-=(unsigned char)inst.d.arg + 1;
 	CHECK_PAGE_TRANSITION(tape, -1, dp, last_page);
 	NEXT
 
+scanright:
+	while (tape[dp%HOT_TAPE]) {
+		dp+=loops[pc];
+		CHECK_PAGE_TRANSITION(tape, 1, dp, last_page);
+	}
+	pc=loops[pc+1];
+	NEXT
+
+scanleft:
+	while (tape[dp%HOT_TAPE]) {
+		dp-=loops[pc];
+		CHECK_PAGE_TRANSITION(tape, -1, dp, last_page);
+	}
+	pc=loops[pc+1];
+	NEXT
+
+block:
+	{
+		unsigned long i;
+
+		for (i = 0; i < loops[pc + 2]; i++) {
+			tape[(dp + i + loops[pc]) % HOT_TAPE] += tape[(dp + i) % HOT_TAPE];
+			tape[(dp + i) % HOT_TAPE] = 0;
+		}
+		dp += loops[pc + 2] - 1;
+		CHECK_PAGE_TRANSITION(tape, 1, dp, last_page);
+		pc = loops[pc + 1];
+	}
+	NEXT
+
 output:
 	putchar(tape[dp%HOT_TAPE]);
 	NEXT
@@ -178,7 +363,23 @@ exit:
 	return;
 }
 
+/* "-" reads the program from stdin, so a generator can pipe into ibf */
 char* read_file(char* filename, unsigned long *program_length) {
+	if (strcmp(filename, "-") == 0) {
+		unsigned long size = 0, capacity = 0x10000;
+		char *string = safe_malloc(capacity);
+		unsigned long n;
+
+		while ((n = fread(string + size, 1, capacity - size - 1, stdin)) > 0) {
+			size += n;
+			if (capacity - size == 1)
+				string = safe_realloc(string, capacity *= 2);
+		}
+		string[size] = 0;
+		*program_length = size;
+		return string;
+	}
+
 	FILE *f = fopen(filename, "rb");
         if (!f) {
                 printf("cannot open file\n");
@@ -6,8 +6,16 @@
 #include <stdio.h>
 #include <string.h>
 
-short *optimize(char program_in[]) {
+/* With offsets set, *offsets receives the byte offset in program_in of
+ * every op, for the source map */
+short *optimize(const char program_in[], unsigned long **offsets) {
         struct vector program_out = vector_create(0);
+        unsigned long *op_offsets = 0;
+
+        if (offsets) {
+                op_offsets = safe_malloc((strlen(program_in) + 2) * (sizeof (unsigned long)));
+                *offsets = op_offsets;
+        }
 
         long ind = 0;
         char last_char = 0;
@@ -46,6 +54,9 @@ short *optimize(char program_in[]) {
 
                         /* 2. Start writing the next block */
                         vector_push(&program_out, cur_char);
+                        if (op_offsets) {
+                                op_offsets[program_out.length / 2] = ind - 1;
+                        }
                         count = 0;
                 }
                 last_char = cur_char;
@@ -0,0 +1,86 @@
+// Profiler: counts the ops executed at every program position and, when the
+// program ends, attributes them to the C functions and lines of the source
+// map, hottest first. Built with -DPROFILER (make ibfprof).
+
+#define PROFILE_TOP 20
+
+unsigned long long *profile_counts;
+
+struct profile_row {
+        const char *name;
+        unsigned long long ops;
+};
+
+void profiler_init(unsigned long program_length) {
+        profile_counts = calloc(program_length, sizeof (unsigned long long));
+        if (!profile_counts) {
+                printf("memory allocation failed\n");
+                exit(1);
+        }
+}
+
+int profile_by_name(const void *a, const void *b) {
+        return strcmp(((const struct profile_row *)a)->name, ((const struct profile_row *)b)->name);
+}
+
+int profile_by_ops(const void *a, const void *b) {
+        unsigned long long x = ((const struct profile_row *)a)->ops;
+        unsigned long long y = ((const struct profile_row *)b)->ops;
+        return x < y ? 1 : x > y ? -1 : 0;
+}
+
+/* Merges the rows of the same name and prints the hottest */
+void profile_print(const char *title, struct profile_row rows[], unsigned long n, unsigned long long total) {
+        unsigned long i, m = 0;
+
+        qsort(rows, n, sizeof (struct profile_row), profile_by_name);
+        for (i = 0; i < n; i++) {
+                if (m && strcmp(rows[m - 1].name, rows[i].name) == 0) {
+                        rows[m - 1].ops += rows[i].ops;
+                } else {
+                        rows[m++] = rows[i];
+                }
+        }
+        qsort(rows, m, sizeof (struct profile_row), profile_by_ops);
+
+        fprintf(stderr, "%14s %7s  %s\n", "ops", "%", title);
+        for (i = 0; i < m && i < PROFILE_TOP && rows[i].ops; i++) {
+                fprintf(stderr, "%14llu %6.2f%%  %s\n", rows[i].ops,
+                        total ? 100.0 * rows[i].ops / total : 0.0, rows[i].name);
+        }
+}
+
+void profiler_report(short program[]) {
+        unsigned long long total = 0;
+        unsigned long n = 0, pc;
+        char offset[32];
+
+        while ((char)program[n]) {
+                n++;
+        }
+        struct profile_row *functions = safe_malloc((n + 1) * (sizeof (struct profile_row)));
+        struct profile_row *lines = safe_malloc((n + 1) * (sizeof (struct profile_row)));
+
+        for (pc = 0; pc < n; pc++) {
+                struct map_entry *e = source_map_find(pc);
+
+                total += profile_counts[pc];
+                if (e) {
+                        functions[pc].name = e->function;
+                        lines[pc].name = e->location;
+                } else {
+                        /* no map: the byte offset of the op stands for its line */
+                        sprintf(offset, "@%lu", op_offsets ? op_offsets[pc] : pc);
+                        functions[pc].name = "?";
+                        lines[pc].name = copy_string(offset);
+                }
+                functions[pc].ops = lines[pc].ops = profile_counts[pc];
+        }
+
+        fprintf(stderr, "\nibf profile: %llu ops\n", total);
+        profile_print("function", functions, n, total);
+        fprintf(stderr, "\n");
+        profile_print("line", lines, n, total);
+        free(functions);
+        free(lines);
+}
@@ -0,0 +1,85 @@
+// Source maps: programs generated by bfgen come with a <program>.bfmap that
+// tells which C file:line and function every range of bytes was generated
+// for (bfg_write_map() in bf/bfgen/include/bfgen.h):
+//
+//      # bfmap 1
+//      <start> <end> <file>:<line> <function>
+
+struct map_entry {
+        unsigned long start;
+        unsigned long end;
+        char *location;
+        char *function;
+};
+
+struct map_entry *source_map;
+unsigned long source_map_length;
+/* byte offset in the program text of every op, filled by optimize() */
+unsigned long *op_offsets;
+
+char *copy_string(const char *s) {
+        return strcpy(safe_malloc(strlen(s) + 1), s);
+}
+
+/* x.b -> x.bfmap */
+char *source_map_name(const char *program_filename) {
+        const char *dot = strrchr(program_filename, '.');
+        size_t length = dot && !strpbrk(dot, "/\\") ? (size_t)(dot - program_filename) : strlen(program_filename);
+        char *name = safe_malloc(length + sizeof ".bfmap");
+
+        memcpy(name, program_filename, length);
+        strcpy(name + length, ".bfmap");
+        return name;
+}
+
+/* A missing map is not an error: the reports fall back to byte offsets */
+void source_map_load(const char *filename) {
+        FILE *f = fopen(filename, "r");
+        unsigned long capacity = 0;
+        char line[1024], location[512], function[256];
+        unsigned long start, end;
+
+        if (!f) {
+                return;
+        }
+        while (fgets(line, sizeof line, f)) {
+                if (line[0] == '#' ||
+                    sscanf(line, "%lu %lu %511s %255s", &start, &end, location, function) != 4) {
+                        continue;
+                }
+                if (source_map_length == capacity) {
+                        capacity = capacity ? capacity * 2 : 256;
+                        source_map = safe_realloc(source_map, capacity * (sizeof (struct map_entry)));
+                }
+                struct map_entry *e = &source_map[source_map_length++];
+                e->start = start;
+                e->end = end;
+                e->location = copy_string(location);
+                e->function = copy_string(function);
+        }
+        fclose(f);
+}
+
+/* The entry the op at pc was generated for, 0 if there is none. The
+ * entries are in program order. */
+struct map_entry *source_map_find(unsigned long pc) {
+        unsigned long lo = 0, hi = source_map_length;
+        unsigned long offset;
+
+        if (!op_offsets || !source_map_length) {
+                return 0;
+        }
+        offset = op_offsets[pc];
+        while (hi - lo > 1) {
+                unsigned long mid = (lo + hi) / 2;
+                if (source_map[mid].start <= offset) {
+                        lo = mid;
+                } else {
+                        hi = mid;
+                }
+        }
+        if (source_map[lo].start <= offset && offset < source_map[lo].end) {
+                return &source_map[lo];
+        }
+        return 0;
+}
@@ -42,6 +42,6 @@ void vector_drop(struct vector *vec) {
 }
 
 void *vector_unwrap(struct vector *vec) {
-        safe_realloc(vec->ptr, vec->length);
+        vec->ptr = safe_realloc(vec->ptr, vec->length);
         return vec->ptr;
 }
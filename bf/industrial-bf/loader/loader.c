@@ -3,6 +3,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
+
+#include "../evaluator/config.h"
 
 void store_page(char *page, long page_size, long page_uid);
 
@@ -11,7 +14,7 @@ int main(int argc, char *argv[]) {
 	long page_size;
 
 	if (argc < 2 || argc > 3) {
-		printf("usage: %s <input> [page_size=4096]\n", argv[0]);
+		printf("usage: %s <input> [page_size=%ld]\n", argv[0], (long)PAGE_SIZE);
 		return 1;
 	}
 
@@ -19,16 +22,24 @@ int main(int argc, char *argv[]) {
 	if (argc == 3) {
 		page_size = atoi(argv[2]);
 	} else {
-		page_size = 4096;
+		/* ibf only reads pages of its own size */
+		page_size = PAGE_SIZE;
 	}
 
 	FILE *f = fopen(filename, "rb");
 	char *tape = malloc(page_size);
 	long page_uid = 0;
+	long size;
 
-	while (fread(tape, 1, page_size, f)) {
-		store_page(tape, page_size, page_uid++);
+	if (!f || !tape) {
+		printf("cannot read %s\n", filename);
+		return 1;
+	}
+	/* the last page is stored short, ibf reads the rest as zero */
+	while ((size = fread(tape, 1, page_size, f))) {
+		store_page(tape, size, page_uid++);
 	}
+	return 0;
 }
 
 void store_page(char *page, long page_size, long page_uid) {
@@ -0,0 +1,8 @@
+#include <stdio.h>
+
+
+int main()
+{
+printf("\nHello World!");
+return 0;
+}
\ No newline at end of file
@@ -0,0 +1,3 @@
+tcc hello.c -L . -I ./include -o test.exe
+test.exe
+tcc ../doom/am_map.c ../doom/DOOM.c ../doom/doomdef.c ../doom/doomstat.c ../doom/dstrings.c ../doom/d_items.c ../doom/d_main.c ../doom/d_net.c ../doom/f_finale.c ../doom/f_wipe.c ../doom/g_game.c ../doom/hu_lib.c ../doom/hu_stuff.c ../doom/info.c ../doom/i_net.c ../doom/i_sound.c ../doom/i_system.c ../doom/i_video.c ../doom/m_argv.c ../doom/m_bbox.c ../doom/m_cheat.c ../doom/m_fixed.c ../doom/m_menu.c ../doom/m_misc.c ../doom/m_random.c ../doom/m_swap.c ../doom/p_ceilng.c ../doom/p_doors.c ../doom/p_enemy.c ../doom/p_floor.c ../doom/p_inter.c ../doom/p_lights.c ../doom/p_map.c ../doom/p_maputl.c ../doom/p_mobj.c ../doom/p_plats.c ../doom/p_pspr.c ../doom/p_saveg.c ../doom/p_setup.c ../doom/p_sight.c ../doom/p_spec.c ../doom/p_switch.c ../doom/p_telept.c ../doom/p_tick.c ../doom/p_user.c ../doom/r_bsp.c ../doom/r_data.c ../doom/r_draw.c ../doom/r_main.c ../doom/r_plane.c ../doom/r_segs.c ../doom/r_sky.c ../doom/r_things.c ../doom/sounds.c ../doom/st_lib.c ../doom/st_stuff.c ../doom/s_sound.c ../doom/tables.c ../doom/v_video.c ../doom/wi_stuff.c ../doom/w_wad.c ../doom/z_zone.c ../platform/mini_doom.c -L . -I ./include -I ../platform -luser32 -lgdi32 -o doom.exe
\ No newline at end of file
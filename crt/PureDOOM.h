@@ -75,6 +75,7 @@ typedef int(*doom_eof_fn)(void* handle);
 typedef void(*doom_gettime_fn)(int* sec, int* usec);
 typedef void(*doom_exit_fn)(int code);
 typedef char*(*doom_getenv_fn)(const char* var);
+typedef void*(*doom_map_fn)(void* handle, int* size);
 
 
 // Doom key mapping
@@ -185,6 +186,12 @@ void doom_set_gettime(doom_gettime_fn gettime_fn);
 void doom_set_exit(doom_exit_fn exit_fn);
 void doom_set_getenv(doom_getenv_fn getenv_fn);
 
+// Optional. Returns the whole file behind an open handle if it is in memory
+// (and its size), 0 otherwise. Lumps of such a file are used in place
+// instead of being read into the zone. Doom may write to them, so a mapped
+// file has to be private (copy-on-write), never the file itself.
+void doom_set_file_map(doom_map_fn map_fn);
+
 // Initializes DOOM and start things up. Call only call one
 void doom_init(int argc, char** argv, int flags);
 
@@ -194,6 +201,40 @@ void doom_update();
 // Channels: 1 = indexed, 3 = RGB, 4 = RGBA
 const unsigned char* doom_get_framebuffer(int channels);
 
+// Expands the frame straight into a 32-bit buffer (byte order as
+// doom_get_framebuffer(4)), clipped to width x height. Pitch is in pixels.
+void doom_blit_framebuffer(unsigned int* pixels, int width, int height, int pitch);
+
+// Like doom_blit_framebuffer, every pixel scale x scale, and only the frame
+// rows that changed since the last call; the rest of pixels is left as the
+// last call drew it. rows (200 bytes, may be 0) gets 1 for every
+// frame row redrawn. Returns the number of frame rows redrawn.
+int doom_blit_framebuffer_rows(unsigned int* pixels, int width, int height, int pitch, int scale, unsigned char* rows);
+
+// The 256 colors of the current palette, in the same byte order, for a
+// frontend that converts doom_get_framebuffer(1) itself
+const unsigned int* doom_get_palette();
+
+// doom_timedemo() results, times in microseconds
+typedef struct
+{
+    int frames;                     // frames drawn, wipe steps included
+    int tics;                       // game tics run
+    unsigned long long total;
+    unsigned long long render;      // R_RenderPlayerView
+    unsigned long long ticker;      // P_Ticker
+    unsigned long long status_bar;  // ST_Drawer
+    unsigned long long hud;         // HU_Drawer
+    unsigned long long convert;     // frame to 32-bit pixels
+} doom_timedemo_t;
+
+// Plays the demo lump as fast as it goes, one tic per frame whatever the
+// gettime callback says, and returns at its end: 0, or -1 if there is no
+// such lump or the demo does not start (another version). clock_fn (0: the
+// gettime callback) times it and has to be a real clock. The game carries
+// on with the title loop afterwards.
+int doom_timedemo(const char* demo, doom_gettime_fn clock_fn, doom_timedemo_t* result);
+
 // It is always 2048 bytes in size
 short* doom_get_sound_buffer();
 
@@ -961,6 +1002,7 @@ extern doom_eof_fn doom_eof;
 extern doom_gettime_fn doom_gettime;
 extern doom_exit_fn doom_exit;
 extern doom_getenv_fn doom_getenv;
+extern doom_map_fn doom_map;
 
 
 const char* doom_itoa(int i, int radix);
@@ -6866,6 +6908,7 @@ typedef struct
     void* handle;
     int position;
     int size;
+    void* data; // the lump in place in a mapped file, 0 if it is read
 } lumpinfo_t;
 
 
@@ -6945,6 +6988,8 @@ void  Z_FileDumpHeap(void* f);
 void  Z_CheckHeap(void);
 void  Z_ChangeTag2(void* ptr, int tag);
 int   Z_FreeMemory(void);
+void  Z_AddMapped(void* ptr, int size);
+int   Z_IsMapped(void* ptr);
 
 
 typedef struct memblock_s
@@ -6963,7 +7008,8 @@ typedef struct memblock_s
 //
 #define Z_ChangeTag(p,t) \
 { \
-    if (( (memblock_t *)( (byte *)(p) - sizeof(memblock_t)))->id!=0x1d4a11) \
+    if (!Z_IsMapped(p) && \
+        ( (memblock_t *)( (byte *)(p) - sizeof(memblock_t)))->id!=0x1d4a11) \
     { \
         /*I_Error("Error: Z_CT at "__FILE__":%i",__LINE__);*/ \
         char buf[260]; \
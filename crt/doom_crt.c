@@ -10,14 +10,19 @@ void MiniDoomKeyDown(int vKey);
 void MiniDoomKeyUp(int vKey);
 void MiniDoomStart(const char* homeDir, const char* fileName);
 int MiniDoomKeyTranslate(int key);
+void MiniDoomExit(int code);
 void EnvHeapSetup();
 void EnvHeapFree(void* pv);
 void* EnvHeapMalloc(size_t xWantedSize);
+void* EnvHeapMallocAt(size_t xWantedSize, const void* pvCaller);
+void EnvHeapReport();
 
 #define DOOM_WAD_FILE "doom.wad"
 #define DOOM_WAD_FILE_HANDLE 0x123456
 
-char* g_MiniDoomArgvw[3] = { "doom", "-file", DOOM_WAD_FILE };
+#define DOOM_MAX_ARGS 16
+
+char* g_MiniDoomArgvw[DOOM_MAX_ARGS] = { "doom", "-file", DOOM_WAD_FILE };
 char g_MiniDoomHome[128] = {0};
 int g_MiniDoomWadDataOffset = 0;
 
@@ -63,6 +68,15 @@ int MiniDoomEof(void* Handle)
     return g_MiniDoomWadDataOffset >= g_DoomWadSize;
 }
 
+// The WAD is in memory already: W_CacheLumpNum points into it
+void* MiniDoomMap(void* Handle, int* Size)
+{
+    if (Handle != (void*)DOOM_WAD_FILE_HANDLE)
+        return NULL;
+    *Size = g_DoomWadSize;
+    return g_DoomWadAddress;
+}
+
 int MiniDoomSeek(void* Handle, int Offset, doom_seek_t SeekType)
 {
 if (Handle == NULL)
@@ -78,7 +92,13 @@ if (Handle == NULL)
 
 void* MiniDoomMalloc(int size)
 {
-    return EnvHeapMalloc(size);
+    /* Counted for the Doom code that called doom_malloc. */
+    void* mem = EnvHeapMallocAt(size, __builtin_return_address(0));
+    if (mem == NULL && size > 0)
+    {
+        MiniDoomExit(-1);
+    }
+    return mem;
 }
 
 void MiniDoomFree(void* Mem)
@@ -95,6 +115,7 @@ void MiniDoomPrint(const char* String)
 void MiniDoomExit(int code)
 {
     printf("[DOOM]: Exiting with code %d\n", code);
+    EnvExit(code);
     while (1);
     //Running = FALSE;
 }
@@ -158,74 +179,155 @@ void MiniDoomGetKeys()
 
 }
 
-void MiniDoomPutPixel(char* p_imgBuf, int x, int y, int imgWidth, int imgHeight, int color)
+void CrtDoomInit()
 {
-    int* p_pixels = (int*)p_imgBuf;
-    if (p_imgBuf == NULL)
-    {
-        return;
-    }
-    if (x < 0 || x >= imgWidth)
-    {
-        return;
-    }
-    if (y < 0 || y >= imgHeight)
-    {
-        return;
-    }
-    p_pixels[y * imgWidth + x] = color;
+    CrtDoomInitArgs(0, NULL);
 }
 
-
-void CrtDoomInit()
+void CrtDoomInitArgs(int argc, char **argv)
 {
+    int i;
+    int args = 3;
+
+    for (i = 0; i < argc && args < DOOM_MAX_ARGS; i++)
+    {
+        g_MiniDoomArgvw[args++] = argv[i];
+    }
+
     EnvHeapSetup();
 
     doom_set_file_io(MiniDoomOpen, MiniDoomClose, MiniDoomRead, NULL,
         MiniDoomSeek, MiniDoomTell, MiniDoomEof);
+    doom_set_file_map(MiniDoomMap);
     doom_set_malloc(MiniDoomMalloc, MiniDoomFree);
     doom_set_exit(MiniDoomExit);
     doom_set_getenv(MiniDoomGetEnv);
     doom_set_gettime(MiniDoomGetTime);
     doom_set_print(MiniDoomPrint);
 
-    doom_init(3, g_MiniDoomArgvw, 0);
+    doom_init(args, g_MiniDoomArgvw, 0);
+}
+
+void CrtDoomHeapReport()
+{
+    EnvHeapReport();
+}
+
+static void CrtDoomTimedemoLine(const char *name, unsigned long long usec, unsigned long long total)
+{
+    printf("TIMEDEMO: %-20s %8u ms %3u%%\n", name, (unsigned int)(usec / 1000),
+        total ? (unsigned int)(usec * 100 / total) : 0);
+}
+
+int CrtDoomTimedemo(const char *demo, void (*clock_fn)(int *sec, int *usec))
+{
+    doom_timedemo_t result;
+    unsigned long long other;
+    unsigned int fps10;
+
+    if (doom_timedemo(demo, clock_fn, &result))
+    {
+        printf("TIMEDEMO: %s did not start\n", demo);
+        return -1;
+    }
+
+    fps10 = result.total ? (unsigned int)(result.frames * 10000000ULL / result.total) : 0;
+    printf("TIMEDEMO: %s, %d tics, %d frames in %u ms, %u.%u fps\n", demo, result.tics,
+        result.frames, (unsigned int)(result.total / 1000), fps10 / 10, fps10 % 10);
+    CrtDoomTimedemoLine("R_RenderPlayerView", result.render, result.total);
+    CrtDoomTimedemoLine("P_Ticker", result.ticker, result.total);
+    CrtDoomTimedemoLine("ST_Drawer", result.status_bar, result.total);
+    CrtDoomTimedemoLine("HU_Drawer", result.hud, result.total);
+    CrtDoomTimedemoLine("framebuffer", result.convert, result.total);
+    other = result.total - result.render - result.ticker - result.status_bar - result.hud - result.convert;
+    CrtDoomTimedemoLine("other", other, result.total);
+    return 0;
 }
 
 void CrtDoomIteration()
 {
-    int* framebuffer = NULL;
-    int x = 0;
-    int y = 0;
+    struct DoomControlRegs *regs = g_DoomControlRegs;
+
     doom_update();
-    framebuffer = (int*)doom_get_framebuffer(4);
-    for (y = 0; y < 200; y++)
+    if (regs->format == CRT_DOOM_PIXELS_INDEXED)
     {
-        for (x = 0; x < 320; x++)
-        {
-            MiniDoomPutPixel(g_DoomControlRegs->pixels, x, y, g_DoomControlRegs->width, g_DoomControlRegs->height, framebuffer[x + y * 320]);
-        }
+        regs->indexed = doom_get_framebuffer(1);
+        regs->palette = doom_get_palette();
+    }
+    else
+    {
+        /* the frame goes through the palette straight into the frontend's pixels */
+        regs->rows_redrawn = doom_blit_framebuffer_rows((unsigned int*)regs->pixels,
+            regs->width, regs->height, regs->pitch ? regs->pitch : regs->width,
+            regs->scale ? regs->scale : 1, regs->rows);
     }
     MiniDoomGetKeys();
 }
 
+/*
+ * The block routines align the destination and then move a word at a time;
+ * x86 does not mind the source being unaligned. With gcc and SSE2 the copy
+ * and the fill move 16 bytes at a time through a vector type (the crt has
+ * its own size_t and cannot include the intrinsics headers).
+ */
+#if defined(__GNUC__) && !defined(__TINYC__)
+typedef unsigned long __attribute__((__may_alias__)) crtdoom_word;
+#if defined(__SSE2__)
+#define CRTDOOM_VECTOR
+typedef unsigned char crtdoom_vector __attribute__((__vector_size__(16), __aligned__(1), __may_alias__));
+#endif
+#else
+typedef unsigned long crtdoom_word;
+#endif
+
+#define CRTDOOM_WORD_SIZE ((int)sizeof(crtdoom_word))
+#define CRTDOOM_ALIGNED(p) (((unsigned long)(p) & (sizeof(crtdoom_word) - 1)) == 0)
+
 void *crtdoom_memset(void *addr, int val, int len)
 {
-	char *p;
+	unsigned char *p;
+	crtdoom_word w;
 
-	p = (char *)addr;
-	while (len--)
+	p = (unsigned char *)addr;
+	while (len > 0 && !CRTDOOM_ALIGNED(p)) {
+		*p++ = val;
+		len--;
+	}
+	/* the byte in every byte of the word */
+	w = (~(crtdoom_word)0 / 0xff) * (unsigned char)val;
+#ifdef CRTDOOM_VECTOR
+	{
+		crtdoom_vector v = { 0 };
+
+		v += (unsigned char)val;
+		for (; len >= 16; len -= 16, p += 16)
+			*(crtdoom_vector *)p = v;
+	}
+#endif
+	for (; len >= CRTDOOM_WORD_SIZE; len -= CRTDOOM_WORD_SIZE, p += CRTDOOM_WORD_SIZE)
+		*(crtdoom_word *)p = w;
+	while (len-- > 0)
 		*p++ = val;
 	return addr;
 }
 
 void *crtdoom_memcpy(void *dest, const void *src, int len)
 {
-	char *p, *q;
+	unsigned char *p, *q;
 
-	p = (char *)dest;
-	q = (char *)src;
-	while (len--)
+	p = (unsigned char *)dest;
+	q = (unsigned char *)src;
+	while (len > 0 && !CRTDOOM_ALIGNED(p)) {
+		*p++ = *q++;
+		len--;
+	}
+#ifdef CRTDOOM_VECTOR
+	for (; len >= 16; len -= 16, p += 16, q += 16)
+		*(crtdoom_vector *)p = *(const crtdoom_vector *)q;
+#endif
+	for (; len >= CRTDOOM_WORD_SIZE; len -= CRTDOOM_WORD_SIZE, p += CRTDOOM_WORD_SIZE, q += CRTDOOM_WORD_SIZE)
+		*(crtdoom_word *)p = *(const crtdoom_word *)q;
+	while (len-- > 0)
 		*p++ = *q++;
 	return dest;
 }
@@ -249,6 +351,12 @@ int crtdoom_memcmp (const void *p1, const void *p2, int len)
 
 	q1 = (char *)p1;
 	q2 = (char *)p2;
+	/* skip the equal words, the bytes decide the result */
+	while (len >= CRTDOOM_WORD_SIZE && *(const crtdoom_word *)q1 == *(const crtdoom_word *)q2) {
+		q1 += CRTDOOM_WORD_SIZE;
+		q2 += CRTDOOM_WORD_SIZE;
+		len -= CRTDOOM_WORD_SIZE;
+	}
 	for (r = 0, i = 0; !r && i < len; i++)
 		r = *q1++ - *q2++;
 	return r;
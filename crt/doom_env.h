@@ -2,6 +2,8 @@
 
 extern void *g_DoomHeapAddress;
 extern unsigned int g_DoomHeapSize;
+/* The WAD image. Doom uses its lumps in place and may write to them, so
+ * it has to be writable memory (a private mapping will do). */
 extern char *g_DoomWadAddress;
 extern unsigned int g_DoomWadSize;
 
@@ -15,6 +17,13 @@ extern unsigned int g_DoomWadSize;
 #define CRT_DOOM_KEY_ESCAPE 8
 #define CRT_DOOM_KEY_Y 9
 
+/* DoomControlRegs.format */
+#define CRT_DOOM_PIXELS_RGBA 0
+#define CRT_DOOM_PIXELS_INDEXED 1
+
+#define CRT_DOOM_FRAME_WIDTH 320
+#define CRT_DOOM_FRAME_HEIGHT 200
+
 struct DoomKey
 {
     int key;
@@ -29,11 +38,43 @@ struct DoomControlRegs
     int time_sec;
     int time_usec;
     struct DoomKey keys[16];
+    /*
+     * The frontend registers its buffer once: pixels, width, height and
+     * pitch (pixels per row, 0 for width) stay valid across iterations.
+     * With CRT_DOOM_PIXELS_RGBA every iteration renders the 32-bit frame
+     * straight into pixels. With CRT_DOOM_PIXELS_INDEXED pixels is not
+     * touched; the iteration hands back the 320x200 indexed frame and its
+     * palette instead, for the frontend to convert.
+     *
+     * In RGBA every frame pixel covers scale x scale pixels (0 for 1), and
+     * only frame rows that changed are redrawn: rows[y] is 1 for every
+     * frame row y the iteration redrew, rows_redrawn counts them. The rest
+     * of pixels is as the previous iteration left it.
+     */
+    int pitch;
+    int format;
+    const unsigned char *indexed;
+    const unsigned int *palette;
+    int scale;
+    int rows_redrawn;
+    unsigned char rows[CRT_DOOM_FRAME_HEIGHT];
 };
 
 extern struct DoomControlRegs *g_DoomControlRegs;
 
 void EnvPutChar(int c);
+/* Doom quit or failed. The crt spins if this returns. */
+void EnvExit(int code);
 
 void CrtDoomInit();
-void CrtDoomIteration();
\ No newline at end of file
+/* CrtDoomInit with more Doom command line arguments after the default
+ * ones, e.g. -playdemo demo1. */
+void CrtDoomInitArgs(int argc, char **argv);
+void CrtDoomIteration();
+/* Heap statistics, allocation histogram and call sites on the console. */
+void CrtDoomHeapReport();
+/* Plays the demo lump as fast as it goes and prints FPS and the time per
+ * subsystem. The registers' time is not read meanwhile; clock_fn has to
+ * be a real clock. Returns 0, or -1 if there is no such lump or the demo
+ * does not start (another version). */
+int CrtDoomTimedemo(const char *demo, void (*clock_fn)(int *sec, int *usec));
\ No newline at end of file
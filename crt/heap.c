@@ -1,24 +1,93 @@
 #include "doom_crt.h"
 #include "doom_env.h"
 
+/*
+ * Segregated heap: small requests come from size classes, large ones from
+ * power-of-two bins of free blocks.
+ *
+ * Every block starts with a HeapBlockLink. Its size field holds the size of
+ * the whole block, header included, with the allocated bit in the MSB; an
+ * allocated block has no "next" pointer.
+ *
+ * Small blocks (up to HEAP_SMALL_MAX bytes) are cut from slabs, large
+ * blocks of HEAP_SLAB_SIZE taken from the bins. Each size class keeps a
+ * LIFO list of freed blocks and bumps through its current slab, so both
+ * malloc and free are a handful of pointer moves. Slabs are never given
+ * back.
+ *
+ * Large free blocks are kept in bins by floor(log2(size)), with a bitmap
+ * of the bins that are not empty. A free large block also links back to
+ * its predecessor in the bin and repeats its size in its last word, and
+ * the block after it has HEAP_PREV_FREE set: freeing merges with both
+ * neighbours without walking any list. Allocation looks at the first few
+ * blocks of the request's own bin and otherwise takes the head of the next
+ * non-empty bin, whose blocks are all big enough. Only when there is none
+ * does it go through the rest of its own bin.
+ *
+ * Each region ends with an allocated, empty end marker so no merge runs
+ * past it.
+ */
+
 typedef struct _HeapBlockLink
 {
-    struct _HeapBlockLink* pxNextFreeBlock; /**< The next free block in the list. */
-    size_t xBlockSize;                     /**< The size of the free block. */
+    struct _HeapBlockLink* pxNextFreeBlock; /**< The next free block of the same bin or class. */
+    size_t xBlockSize;                     /**< Size of the block with its header, plus flags. */
 } HeapBlockLink;
 
+/* A free large block; its last word repeats the size. */
+typedef struct _HeapFreeBlock
+{
+    HeapBlockLink xLink;
+    struct _HeapFreeBlock* pxPrevFreeBlock; /**< The previous free block of the same bin. */
+} HeapFreeBlock;
+
+#define HEAP_SIZE_CLASSES    13
+#define HEAP_BINS            ( sizeof( size_t ) * 8 )
+#define HEAP_SITES           64
+
+typedef struct _HeapSizeClass
+{
+    HeapBlockLink* pxFreeList;  /**< Freed blocks of this class. */
+    uint8_t* pucSlabNext;       /**< Untouched part of the current slab. */
+    uint8_t* pucSlabEnd;
+} HeapSizeClass;
+
+/* Allocations made from one return address, see Heap_MallocAt(). */
+typedef struct _HeapSite
+{
+    const void* pvCaller;
+    size_t xAllocations;
+    size_t xRequestedBytes;
+} HeapSite;
+
 typedef struct _HeapCfg
 {
-    /* Create a couple of list links to mark the start and end of the list. */
-    HeapBlockLink HeapStart;
-    HeapBlockLink* pHeapEnd;
+    HeapFreeBlock* pxBins[HEAP_BINS];
+    size_t xBinMap;             /**< Bit k is set when bin k is not empty. */
+    HeapSizeClass xClasses[HEAP_SIZE_CLASSES];
+    HeapBlockLink* pHeapEnd;    /**< End marker of the last region, NULL before the heap is defined. */
 
     /* Keeps track of the number of calls to allocate and free memory as well as the
-     * number of free bytes remaining, but says nothing about fragmentation. */
+     * number of free bytes remaining (free blocks, free small blocks and the
+     * untouched part of the slabs). */
     size_t HeapFreeBytesRemaining;
     size_t HeapMinimumEverFreeBytesRemaining;
     size_t HeapNumberOfSuccessfulAllocations;
     size_t HeapNumberOfSuccessfulFrees;
+    size_t HeapSlabBytes;
+    size_t HeapTotalBytes;
+
+    /* Histogram of the allocations by size class and, for large blocks, by
+     * bin: all of them and the ones not freed yet. */
+    size_t xClassAllocations[HEAP_SIZE_CLASSES];
+    size_t xClassLive[HEAP_SIZE_CLASSES];
+    size_t xBinAllocations[HEAP_BINS];
+    size_t xBinLive[HEAP_BINS];
+
+    /* Allocations by call site; the ones that find the table full are only
+     * counted. */
+    HeapSite xSites[HEAP_SITES];
+    size_t xOtherSiteAllocations;
 
     void (*pAssert)(const char *text, int line);
 } HeapCfg;
@@ -29,63 +98,31 @@ typedef struct _HeapRegion
     size_t   xSizeInBytes;
 } HeapRegion;
 
+/* Snapshot of the free space, see Heap_GetStats(). */
+typedef struct _HeapStats
+{
+    size_t xTotalBytes;             /**< Of all regions, less the end markers. */
+    size_t xPeakUsedBytes;          /**< High-water mark of the bytes in use. */
+    size_t xFreeBytes;              /**< Same as Heap_GetFreeHeapSize(). */
+    size_t xLargeFreeBytes;         /**< In free large blocks. */
+    size_t xLargeFreeBlocks;
+    size_t xLargestFreeBlock;
+    size_t xSlabBytes;              /**< Taken by slabs for the size classes. */
+    size_t xSlabFreeBytes;          /**< Free small blocks and untouched slab space. */
+    size_t xSmallFreeBlocks;        /**< On the lists of the size classes. */
+    unsigned int xFragmentation;    /**< 100 - largest free block in % of the large free bytes. */
+} HeapStats;
+
 void Heap_ResetState(HeapCfg *p_heap);
 void Heap_DefineHeapRegions(HeapCfg* p_heap, const HeapRegion* const pxHeapRegions);
 void* Heap_Calloc(HeapCfg* p_heap, size_t xNum, size_t xSize);
 size_t Heap_GetMinimumEverFreeHeapSize(HeapCfg* p_heap);
 size_t Heap_GetFreeHeapSize(HeapCfg* p_heap);
+void Heap_GetStats(HeapCfg* p_heap, HeapStats* pxStats);
 void Heap_Free(HeapCfg* p_heap, void* pv);
 void* Heap_Malloc(HeapCfg* p_heap, size_t xWantedSize);
-
-/*
- * A sample implementation of pvPortMalloc() that allows the heap to be defined
- * across multiple non-contiguous blocks and combines (coalescences) adjacent
- * memory blocks as they are freed.
- *
- * See heap_1.c, heap_2.c, heap_3.c and heap_4.c for alternative
- * implementations, and the memory management pages of https://www.FreeRTOS.org
- * for more information.
- *
- * Usage notes:
- *
- * vPortDefineHeapRegions() ***must*** be called before pvPortMalloc().
- * pvPortMalloc() will be called if any task objects (tasks, queues, event
- * groups, etc.) are created, therefore vPortDefineHeapRegions() ***must*** be
- * called before any other objects are defined.
- *
- * vPortDefineHeapRegions() takes a single parameter.  The parameter is an array
- * of HeapRegion_t structures.  HeapRegion_t is defined in portable.h as
- *
- * typedef struct HeapRegion
- * {
- *  uint8_t *pucStartAddress; << Start address of a block of memory that will be part of the heap.
- *  size_t xSizeInBytes;      << Size of the block of memory.
- * } HeapRegion_t;
- *
- * The array is terminated using a NULL zero sized region definition, and the
- * memory regions defined in the array ***must*** appear in address order from
- * low address to high address.  So the following is a valid example of how
- * to use the function.
- *
- * HeapRegion_t xHeapRegions[] =
- * {
- *  { ( uint8_t * ) 0x80000000UL, 0x10000 }, << Defines a block of 0x10000 bytes starting at address 0x80000000
- *  { ( uint8_t * ) 0x90000000UL, 0xa0000 }, << Defines a block of 0xa0000 bytes starting at address of 0x90000000
- *  { NULL, 0 }                << Terminates the array.
- * };
- *
- * vPortDefineHeapRegions( xHeapRegions ); << Pass the array into vPortDefineHeapRegions().
- *
- * Note 0x80000000 is the lower address so appears in the array first.
- *
- */
-
- /* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
-  * all the API functions to use the MPU wrappers.  That should only be done when
-  * task.h is included from an application file. */
-
-
-//OS_ASSERT
+void* Heap_MallocAt(HeapCfg* p_heap, size_t xWantedSize, const void* pvCaller);
+void Heap_Report(HeapCfg* p_heap);
 
 #ifdef _WIN32
 #define portPOINTER_SIZE_TYPE    uint32_t
@@ -95,12 +132,13 @@ void* Heap_Malloc(HeapCfg* p_heap, size_t xWantedSize);
 
 #define HEAP_BYTE_ALIGNMENT         8
 #define HEAP_BYTE_ALIGNMENT_MASK    (0x0007)
-#ifndef HEAP_CLEAR_MEMORY_ON_FREE
-#define HEAP_CLEAR_MEMORY_ON_FREE    0
-#endif
 
-/* Block sizes must not get too small. */
-#define heapMINIMUM_BLOCK_SIZE    ( ( size_t ) ( HEAP_STRUCT_SIZE << 1 ) )
+/* Blocks up to this size (header included) come from the size classes. */
+#define HEAP_SMALL_MAX      2048
+/* Slabs are cut into blocks of one class. */
+#define HEAP_SLAB_SIZE      0x4000
+/* Blocks looked at in the request's own bin before moving up a bin. */
+#define HEAP_BIN_SCAN       4
 
 /* Assumes 8bit bytes! */
 #define heapBITS_PER_BYTE         ( ( size_t ) 8 )
@@ -114,53 +152,275 @@ void* Heap_Malloc(HeapCfg* p_heap, size_t xWantedSize);
 /* Check if adding a and b will result in overflow. */
 #define heapADD_WILL_OVERFLOW( a, b )          ( ( a ) > ( heapSIZE_MAX - ( b ) ) )
 
-/* Check if the subtraction operation ( a - b ) will result in underflow. */
-#define heapSUBTRACT_WILL_UNDERFLOW( a, b )    ( ( a ) < ( b ) )
-
 /* MSB of the xBlockSize member of an HeapBlockLink structure is used to track
  * the allocation status of a block.  When MSB of the xBlockSize member of
  * an HeapBlockLink structure is set then the block belongs to the application.
- * When the bit is free the block is still part of the free heap space. */
+ * When the bit is free the block is still part of the free heap space.
+ * Bit 0 is set when the block before is a free large block. */
 #define heapBLOCK_ALLOCATED_BITMASK    ( ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 ) )
+#define HEAP_PREV_FREE                 ( ( size_t ) 1 )
 #define heapBLOCK_SIZE_IS_VALID( xBlockSize )    ( ( ( xBlockSize ) & heapBLOCK_ALLOCATED_BITMASK ) == 0 )
 #define heapBLOCK_IS_ALLOCATED( pxBlock )        ( ( ( pxBlock->xBlockSize ) & heapBLOCK_ALLOCATED_BITMASK ) != 0 )
-#define heapALLOCATE_BLOCK( pxBlock )            ( ( pxBlock->xBlockSize ) |= heapBLOCK_ALLOCATED_BITMASK )
-#define heapFREE_BLOCK( pxBlock )                ( ( pxBlock->xBlockSize ) &= ~heapBLOCK_ALLOCATED_BITMASK )
-
- 
-#define heapPROTECT_BLOCK_POINTER( pxBlock )    ( pxBlock )
-
-#define heapVALIDATE_BLOCK_POINTER( pxBlock )
+#define heapBLOCK_SIZE( pxBlock )                ( ( pxBlock->xBlockSize ) & ~( heapBLOCK_ALLOCATED_BITMASK | HEAP_BYTE_ALIGNMENT_MASK ) )
 
 #define HEAP_ASSERT(abc) if (!(abc)) { if (p_heap && p_heap->pAssert) {p_heap->pAssert(#abc, __LINE__);} }
 
-/*
- * Inserts a block of memory that is being freed into the correct position in
- * the list of free memory blocks.  The block being freed will be merged with
- * the block in front it and/or the block behind it if the memory blocks are
- * adjacent to each other.
- */
-static void Heap_InsertBlockIntoFreeList(HeapCfg* p_heap, HeapBlockLink* pxBlockToInsert);
-void Heap_DefineRegions(HeapCfg* p_heap, const HeapRegion* const pxHeapRegions);
-
-
 /* The size of the structure placed at the beginning of each allocated memory
  * block must by correctly byte aligned. */
 static const size_t HEAP_STRUCT_SIZE = (sizeof(HeapBlockLink) + ((size_t)(HEAP_BYTE_ALIGNMENT - 1))) & ~((size_t)HEAP_BYTE_ALIGNMENT_MASK);
 
+/* A free large block must hold its links and the size in its last word. */
+#define HEAP_LARGE_MIN    ( ( sizeof( HeapFreeBlock ) + sizeof( size_t ) + HEAP_BYTE_ALIGNMENT_MASK ) & ~( size_t ) HEAP_BYTE_ALIGNMENT_MASK )
+
+/* Block sizes of the classes, header included. */
+static const size_t HeapClassSizes[HEAP_SIZE_CLASSES] =
+{
+    32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048
+};
+
+/* Size class of a small block size, indexed by ( size - 1 ) / 16. */
+static uint8_t HeapClassOfSize[HEAP_SMALL_MAX / 16];
+
+/*-----------------------------------------------------------*/
+
+/* floor( log2( x ) ) for x > 0, in a fixed number of steps. */
+static int Heap_Log2(size_t x)
+{
+    int n = 0;
+    int shift;
+
+    for (shift = (int)(sizeof(size_t) * 4); shift > 0; shift >>= 1)
+    {
+        if (x >> shift)
+        {
+            x >>= shift;
+            n += shift;
+        }
+    }
+    return n;
+}
+
+static size_t* Heap_Footer(HeapBlockLink* pxBlock)
+{
+    return (size_t*)(((uint8_t*)pxBlock) + heapBLOCK_SIZE(pxBlock) - sizeof(size_t));
+}
+
+static HeapBlockLink* Heap_NextBlock(HeapBlockLink* pxBlock)
+{
+    return (HeapBlockLink*)(((uint8_t*)pxBlock) + heapBLOCK_SIZE(pxBlock));
+}
+
+static void Heap_Unlink(HeapCfg* p_heap, HeapFreeBlock* pxBlock)
+{
+    int bin = Heap_Log2(heapBLOCK_SIZE((&pxBlock->xLink)));
+    HeapFreeBlock* pxNext = (HeapFreeBlock*)pxBlock->xLink.pxNextFreeBlock;
+
+    if (pxBlock->pxPrevFreeBlock != NULL)
+    {
+        pxBlock->pxPrevFreeBlock->xLink.pxNextFreeBlock = (HeapBlockLink*)pxNext;
+    }
+    else
+    {
+        p_heap->pxBins[bin] = pxNext;
+        if (pxNext == NULL)
+        {
+            p_heap->xBinMap &= ~(((size_t)1) << bin);
+        }
+    }
+    if (pxNext != NULL)
+    {
+        pxNext->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+    }
+}
+
+/* Turns the xSize bytes at pxBlock into a free large block. The block
+ * before it is never free: free neighbours are always merged. */
+static void Heap_InsertFreeBlock(HeapCfg* p_heap, HeapBlockLink* pxBlock, size_t xSize)
+{
+    HeapFreeBlock* pxFree = (HeapFreeBlock*)pxBlock;
+    int bin = Heap_Log2(xSize);
+
+    pxBlock->xBlockSize = xSize;
+    *Heap_Footer(pxBlock) = xSize;
+    Heap_NextBlock(pxBlock)->xBlockSize |= HEAP_PREV_FREE;
+
+    pxFree->pxPrevFreeBlock = NULL;
+    pxBlock->pxNextFreeBlock = (HeapBlockLink*)p_heap->pxBins[bin];
+    if (p_heap->pxBins[bin] != NULL)
+    {
+        p_heap->pxBins[bin]->pxPrevFreeBlock = pxFree;
+    }
+    p_heap->pxBins[bin] = pxFree;
+    p_heap->xBinMap |= ((size_t)1) << bin;
+}
+
+/* Takes a large block of at least xWantedSize bytes out of the bins. */
+static HeapBlockLink* Heap_LargeMalloc(HeapCfg* p_heap, size_t xWantedSize)
+{
+    HeapFreeBlock* pxBlock;
+    size_t xRemainder;
+    size_t xHigher;
+    int bin = Heap_Log2(xWantedSize);
+    int scanned = 0;
+
+    /* The request's own bin holds blocks from 2^bin up: look at a few. */
+    for (pxBlock = p_heap->pxBins[bin]; pxBlock != NULL && scanned < HEAP_BIN_SCAN; scanned++)
+    {
+        if (heapBLOCK_SIZE((&pxBlock->xLink)) >= xWantedSize)
+        {
+            break;
+        }
+        pxBlock = (HeapFreeBlock*)pxBlock->xLink.pxNextFreeBlock;
+    }
+
+    if (pxBlock == NULL || scanned == HEAP_BIN_SCAN)
+    {
+        /* Any block of a higher bin is big enough. */
+        xHigher = bin + 1 < (int)HEAP_BINS ? p_heap->xBinMap & ~((((size_t)1) << (bin + 1)) - 1) : 0;
+        if (xHigher != 0)
+        {
+            pxBlock = p_heap->pxBins[Heap_Log2(xHigher & (~xHigher + 1))];
+        }
+        else
+        {
+            /* Nothing above: the rest of the own bin is all that is left. */
+            while (pxBlock != NULL && heapBLOCK_SIZE((&pxBlock->xLink)) < xWantedSize)
+            {
+                pxBlock = (HeapFreeBlock*)pxBlock->xLink.pxNextFreeBlock;
+            }
+            if (pxBlock == NULL)
+            {
+                return NULL;
+            }
+        }
+    }
+
+    Heap_Unlink(p_heap, pxBlock);
+    xRemainder = heapBLOCK_SIZE((&pxBlock->xLink)) - xWantedSize;
+    if (xRemainder > HEAP_SMALL_MAX)
+    {
+        /* The rest stays free; the block after it keeps HEAP_PREV_FREE. */
+        pxBlock->xLink.xBlockSize = xWantedSize;
+        Heap_InsertFreeBlock(p_heap, Heap_NextBlock(&pxBlock->xLink), xRemainder);
+    }
+    else
+    {
+        Heap_NextBlock(&pxBlock->xLink)->xBlockSize &= ~HEAP_PREV_FREE;
+    }
+
+    pxBlock->xLink.xBlockSize |= heapBLOCK_ALLOCATED_BITMASK;
+    pxBlock->xLink.pxNextFreeBlock = NULL;
+    return &pxBlock->xLink;
+}
+
+static void Heap_LargeFree(HeapCfg* p_heap, HeapBlockLink* pxBlock)
+{
+    size_t xSize = heapBLOCK_SIZE(pxBlock);
+    HeapBlockLink* pxNext = Heap_NextBlock(pxBlock);
+
+    if (pxBlock->xBlockSize & HEAP_PREV_FREE)
+    {
+        size_t xPrevSize = *(((size_t*)pxBlock) - 1);
+
+        pxBlock = (HeapBlockLink*)(((uint8_t*)pxBlock) - xPrevSize);
+        Heap_Unlink(p_heap, (HeapFreeBlock*)pxBlock);
+        xSize += xPrevSize;
+    }
+    if (!heapBLOCK_IS_ALLOCATED(pxNext))
+    {
+        Heap_Unlink(p_heap, (HeapFreeBlock*)pxNext);
+        xSize += heapBLOCK_SIZE(pxNext);
+    }
+    Heap_InsertFreeBlock(p_heap, pxBlock, xSize);
+}
+
+static HeapBlockLink* Heap_SmallMalloc(HeapCfg* p_heap, size_t xWantedSize)
+{
+    HeapSizeClass* pxClass = &p_heap->xClasses[HeapClassOfSize[(xWantedSize - 1) / 16]];
+    size_t xClassSize = HeapClassSizes[pxClass - p_heap->xClasses];
+    HeapBlockLink* pxBlock = pxClass->pxFreeList;
+
+    if (pxBlock != NULL)
+    {
+        pxClass->pxFreeList = pxBlock->pxNextFreeBlock;
+    }
+    else
+    {
+        if ((size_t)(pxClass->pucSlabEnd - pxClass->pucSlabNext) < xClassSize)
+        {
+            HeapBlockLink* pxSlab = Heap_LargeMalloc(p_heap, HEAP_SLAB_SIZE);
+
+            if (pxSlab == NULL)
+            {
+                return NULL;
+            }
+            /* The slab is a large block that stays allocated; its header and
+             * the tail too short for a block are never handed out. */
+            p_heap->HeapSlabBytes += HEAP_SLAB_SIZE;
+            p_heap->HeapFreeBytesRemaining -= HEAP_STRUCT_SIZE + (heapBLOCK_SIZE(pxSlab) - HEAP_STRUCT_SIZE) % xClassSize;
+            pxClass->pucSlabNext = ((uint8_t*)pxSlab) + HEAP_STRUCT_SIZE;
+            pxClass->pucSlabEnd = ((uint8_t*)pxSlab) + heapBLOCK_SIZE(pxSlab);
+        }
+        pxBlock = (HeapBlockLink*)pxClass->pucSlabNext;
+        pxClass->pucSlabNext += xClassSize;
+    }
+
+    pxBlock->xBlockSize = xClassSize | heapBLOCK_ALLOCATED_BITMASK;
+    pxBlock->pxNextFreeBlock = NULL;
+    return pxBlock;
+}
+
+static void Heap_CountAllocation(HeapCfg* p_heap, size_t xBlockSize, size_t xRequestedSize, const void* pvCaller)
+{
+    HeapSite* pxSite;
+    int xSite;
+    int xProbe;
+
+    if (xBlockSize <= HEAP_SMALL_MAX)
+    {
+        p_heap->xClassAllocations[HeapClassOfSize[(xBlockSize - 1) / 16]]++;
+        p_heap->xClassLive[HeapClassOfSize[(xBlockSize - 1) / 16]]++;
+    }
+    else
+    {
+        p_heap->xBinAllocations[Heap_Log2(xBlockSize)]++;
+        p_heap->xBinLive[Heap_Log2(xBlockSize)]++;
+    }
+
+    /* Open addressing on the return address. */
+    xSite = (int)((((portPOINTER_SIZE_TYPE)pvCaller) >> 2) % HEAP_SITES);
+    for (xProbe = 0; xProbe < HEAP_SITES; xProbe++)
+    {
+        pxSite = &p_heap->xSites[(xSite + xProbe) % HEAP_SITES];
+        if (pxSite->pvCaller == pvCaller || pxSite->xAllocations == 0)
+        {
+            pxSite->pvCaller = pvCaller;
+            pxSite->xAllocations++;
+            pxSite->xRequestedBytes += xRequestedSize;
+            return;
+        }
+    }
+    p_heap->xOtherSiteAllocations++;
+}
 
 /*-----------------------------------------------------------*/
 
-void* Heap_Malloc(HeapCfg * p_heap, size_t xWantedSize)
+void* Heap_Malloc(HeapCfg* p_heap, size_t xWantedSize)
+{
+    return Heap_MallocAt(p_heap, xWantedSize, __builtin_return_address(0));
+}
+/*-----------------------------------------------------------*/
+
+/* pvCaller is the call site the allocation is counted for. */
+void* Heap_MallocAt(HeapCfg * p_heap, size_t xWantedSize, const void* pvCaller)
 {
     HeapBlockLink* pxBlock = NULL;
-    HeapBlockLink* pxPreviousBlock = NULL;
-    HeapBlockLink* pxNewBlockLink = NULL;
     void* pvReturn = NULL;
+    size_t xRequestedSize = xWantedSize;
     size_t xAdditionalRequiredSize= 0;
 
     /* The heap must be initialised before the first call to
-     * pvPortMalloc(). */
+     * Heap_Malloc(). */
     HEAP_ASSERT(p_heap->pHeapEnd);
 
     if (xWantedSize > 0)
@@ -194,88 +454,46 @@ void* Heap_Malloc(HeapCfg * p_heap, size_t xWantedSize)
         }
     }
 
+    /* Check the block size we are trying to allocate is not so large that the
+     * top bit is set.  The top bit of the block size member of the HeapBlockLink
+     * structure is used to determine who owns the block - the application or
+     * the heap, so it must be free. */
+    if (heapBLOCK_SIZE_IS_VALID(xWantedSize) != 0 && xWantedSize > 0 &&
+        xWantedSize <= p_heap->HeapFreeBytesRemaining)
     {
-        /* Check the block size we are trying to allocate is not so large that the
-         * top bit is set.  The top bit of the block size member of the HeapBlockLink
-         * structure is used to determine who owns the block - the application or
-         * the kernel, so it must be free. */
-        if (heapBLOCK_SIZE_IS_VALID(xWantedSize) != 0)
+        if (xWantedSize <= HEAP_SMALL_MAX)
         {
-            if ((xWantedSize > 0) && (xWantedSize <= p_heap->HeapFreeBytesRemaining))
-            {
-                /* Traverse the list from the start (lowest address) block until
-                 * one of adequate size is found. */
-                pxPreviousBlock = &p_heap->HeapStart;
-                pxBlock = heapPROTECT_BLOCK_POINTER(p_heap->HeapStart.pxNextFreeBlock);
-                heapVALIDATE_BLOCK_POINTER(pxBlock);
+            pxBlock = Heap_SmallMalloc(p_heap, xWantedSize);
+        }
+        else
+        {
+            pxBlock = Heap_LargeMalloc(p_heap, xWantedSize);
+        }
+    }
 
-                while ((pxBlock->xBlockSize < xWantedSize) && (pxBlock->pxNextFreeBlock != heapPROTECT_BLOCK_POINTER(NULL)))
-                {
-                    pxPreviousBlock = pxBlock;
-                    pxBlock = heapPROTECT_BLOCK_POINTER(pxBlock->pxNextFreeBlock);
-                    heapVALIDATE_BLOCK_POINTER(pxBlock);
-                }
+    if (pxBlock != NULL)
+    {
+        p_heap->HeapFreeBytesRemaining -= heapBLOCK_SIZE(pxBlock);
 
-                /* If the end marker was reached then a block of adequate size
-                 * was not found. */
-                if (pxBlock != p_heap->pHeapEnd)
-                {
-                    /* Return the memory space pointed to - jumping over the
-                     * HeapBlockLink structure at its start. */
-                    pvReturn = (void*)(((uint8_t*)heapPROTECT_BLOCK_POINTER(pxPreviousBlock->pxNextFreeBlock)) + HEAP_STRUCT_SIZE);
-                    heapVALIDATE_BLOCK_POINTER(pvReturn);
-
-                    /* This block is being returned for use so must be taken out
-                     * of the list of free blocks. */
-                    pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
-
-                    /* If the block is larger than required it can be split into
-                     * two. */
-                    HEAP_ASSERT(heapSUBTRACT_WILL_UNDERFLOW(pxBlock->xBlockSize, xWantedSize) == 0);
-
-                    if ((pxBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE)
-                    {
-                        /* This block is to be split into two.  Create a new
-                         * block following the number of bytes requested. The void
-                         * cast is used to prevent byte alignment warnings from the
-                         * compiler. */
-                        pxNewBlockLink = (void*)(((uint8_t*)pxBlock) + xWantedSize);
-                        HEAP_ASSERT((((size_t)pxNewBlockLink) & HEAP_BYTE_ALIGNMENT_MASK) == 0);
-
-                        /* Calculate the sizes of two blocks split from the
-                         * single block. */
-                        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
-                        pxBlock->xBlockSize = xWantedSize;
-
-                        /* Insert the new block into the list of free blocks. */
-                        pxNewBlockLink->pxNextFreeBlock = pxPreviousBlock->pxNextFreeBlock;
-                        pxPreviousBlock->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER(pxNewBlockLink);
-                    }
-
-                    p_heap->HeapFreeBytesRemaining -= pxBlock->xBlockSize;
-
-                    if (p_heap->HeapFreeBytesRemaining < p_heap->HeapMinimumEverFreeBytesRemaining)
-                    {
-                        p_heap->HeapMinimumEverFreeBytesRemaining = p_heap->HeapFreeBytesRemaining;
-                    }
-
-                    /* The block is being returned - it is allocated and owned
-                     * by the application and has no "next" block. */
-                    heapALLOCATE_BLOCK(pxBlock);
-                    pxBlock->pxNextFreeBlock = NULL;
-                    p_heap->HeapNumberOfSuccessfulAllocations++;
-                }
-            }
+        if (p_heap->HeapFreeBytesRemaining < p_heap->HeapMinimumEverFreeBytesRemaining)
+        {
+            p_heap->HeapMinimumEverFreeBytesRemaining = p_heap->HeapFreeBytesRemaining;
         }
+        p_heap->HeapNumberOfSuccessfulAllocations++;
+        Heap_CountAllocation(p_heap, heapBLOCK_SIZE(pxBlock), xRequestedSize, pvCaller);
 
-        //traceMALLOC(pvReturn, xWantedSize);
+        /* Return the memory space pointed to - jumping over the
+         * HeapBlockLink structure at its start. */
+        pvReturn = (void*)(((uint8_t*)pxBlock) + HEAP_STRUCT_SIZE);
     }
+
     HEAP_ASSERT((((size_t)pvReturn) & (size_t)HEAP_BYTE_ALIGNMENT_MASK) == 0);
     if (xWantedSize != 0 && pvReturn == NULL)
     {
-        printf("\nFATAL ERROR: HEAP: FAILED TO ALLOCATE %u!", xWantedSize);
-        //asm_cli();
-        while(10);
+        /* The caller decides what a failed allocation means; the report
+         * tells how the heap got there. */
+        printf("\nFATAL ERROR: HEAP: FAILED TO ALLOCATE %u!\n", xRequestedSize);
+        Heap_Report(p_heap);
     }
     return pvReturn;
 }
@@ -285,6 +503,7 @@ void Heap_Free(HeapCfg* p_heap, void* pv)
 {
     uint8_t* puc = (uint8_t*)pv;
     HeapBlockLink* pxLink;
+    size_t xSize;
 
     if (pv != NULL)
     {
@@ -295,25 +514,30 @@ void Heap_Free(HeapCfg* p_heap, void* pv)
         /* This casting is to keep the compiler from issuing warnings. */
         pxLink = (void*)puc;
 
-        heapVALIDATE_BLOCK_POINTER(pxLink);
         HEAP_ASSERT(heapBLOCK_IS_ALLOCATED(pxLink) != 0);
         HEAP_ASSERT(pxLink->pxNextFreeBlock == NULL);
 
-        if (heapBLOCK_IS_ALLOCATED(pxLink) != 0)
+        if (heapBLOCK_IS_ALLOCATED(pxLink) != 0 && pxLink->pxNextFreeBlock == NULL)
         {
-            if (pxLink->pxNextFreeBlock == NULL)
+            xSize = heapBLOCK_SIZE(pxLink);
+            p_heap->HeapFreeBytesRemaining += xSize;
+
+            if (xSize <= HEAP_SMALL_MAX)
             {
-                /* The block is being returned to the heap - it is no longer
-                 * allocated. */
-                heapFREE_BLOCK(pxLink);
-                {
-                    /* Add this block to the list of free blocks. */
-                    p_heap->HeapFreeBytesRemaining += pxLink->xBlockSize;
-                    //traceFREE(pv, pxLink->xBlockSize);
-                    Heap_InsertBlockIntoFreeList(p_heap, (HeapBlockLink*)pxLink);
-                    p_heap->HeapNumberOfSuccessfulFrees++;
-                }
+                /* Back on the list of its class. */
+                HeapSizeClass* pxClass = &p_heap->xClasses[HeapClassOfSize[(xSize - 1) / 16]];
+
+                p_heap->xClassLive[pxClass - p_heap->xClasses]--;
+                pxLink->xBlockSize = xSize;
+                pxLink->pxNextFreeBlock = pxClass->pxFreeList;
+                pxClass->pxFreeList = pxLink;
             }
+            else
+            {
+                p_heap->xBinLive[Heap_Log2(xSize)]--;
+                Heap_LargeFree(p_heap, pxLink);
+            }
+            p_heap->HeapNumberOfSuccessfulFrees++;
         }
     }
 }
@@ -331,89 +555,119 @@ size_t Heap_GetMinimumEverFreeHeapSize(HeapCfg* p_heap)
 }
 /*-----------------------------------------------------------*/
 
-void* Heap_Calloc(HeapCfg* p_heap, size_t xNum, size_t xSize)
+/* Walks the bins, so this is for reports rather than for every call. */
+void Heap_GetStats(HeapCfg* p_heap, HeapStats* pxStats)
 {
-    void* pv = NULL;
+    HeapFreeBlock* pxBlock;
+    HeapBlockLink* pxSmall;
+    size_t bin;
 
-    if (heapMULTIPLY_WILL_OVERFLOW(xNum, xSize) == 0)
-    {
-        pv = Heap_Malloc(p_heap, xNum * xSize);
+    memset(pxStats, 0, sizeof(*pxStats));
+    pxStats->xTotalBytes = p_heap->HeapTotalBytes;
+    pxStats->xPeakUsedBytes = p_heap->HeapTotalBytes - p_heap->HeapMinimumEverFreeBytesRemaining;
+    pxStats->xFreeBytes = p_heap->HeapFreeBytesRemaining;
+    pxStats->xSlabBytes = p_heap->HeapSlabBytes;
 
-        if (pv != NULL)
+    for (bin = 0; bin < HEAP_SIZE_CLASSES; bin++)
+    {
+        for (pxSmall = p_heap->xClasses[bin].pxFreeList; pxSmall != NULL; pxSmall = pxSmall->pxNextFreeBlock)
         {
-            (void)memset(pv, 0, xNum * xSize);
+            pxStats->xSmallFreeBlocks++;
         }
     }
 
-    return pv;
-}
-/*-----------------------------------------------------------*/
-
-static void Heap_InsertBlockIntoFreeList(HeapCfg* p_heap, HeapBlockLink* pxBlockToInsert) /* PRIVILEGED_FUNCTION */
-{
-    HeapBlockLink* pxIterator = NULL;
-    uint8_t* puc = NULL;
-
-    /* Iterate through the list until a block is found that has a higher address
-     * than the block being inserted. */
-    for (pxIterator = &p_heap->HeapStart; heapPROTECT_BLOCK_POINTER(pxIterator->pxNextFreeBlock) < pxBlockToInsert; 
-        pxIterator = heapPROTECT_BLOCK_POINTER(pxIterator->pxNextFreeBlock))
+    for (bin = 0; bin < HEAP_BINS; bin++)
     {
-        /* Nothing to do here, just iterate to the right position. */
-    }
+        for (pxBlock = p_heap->pxBins[bin]; pxBlock != NULL; pxBlock = (HeapFreeBlock*)pxBlock->xLink.pxNextFreeBlock)
+        {
+            size_t xSize = heapBLOCK_SIZE((&pxBlock->xLink));
 
-    if (pxIterator != &p_heap->HeapStart)
+            pxStats->xLargeFreeBytes += xSize;
+            pxStats->xLargeFreeBlocks++;
+            if (xSize > pxStats->xLargestFreeBlock)
+            {
+                pxStats->xLargestFreeBlock = xSize;
+            }
+        }
+    }
+    pxStats->xSlabFreeBytes = pxStats->xFreeBytes - pxStats->xLargeFreeBytes;
+    if (pxStats->xLargeFreeBytes != 0)
     {
-        heapVALIDATE_BLOCK_POINTER(pxIterator);
+        pxStats->xFragmentation = 100 - (unsigned int)(((unsigned long long)pxStats->xLargestFreeBlock * 100) / pxStats->xLargeFreeBytes);
     }
+}
+/*-----------------------------------------------------------*/
 
-    /* Do the block being inserted, and the block it is being inserted after
-     * make a contiguous block of memory? */
-    puc = (uint8_t*)pxIterator;
-
-    if ((puc + pxIterator->xBlockSize) == (uint8_t*)pxBlockToInsert)
+/* Prints the statistics, the histogram and the call sites. The sizes in the
+ * histogram include the block header. */
+void Heap_Report(HeapCfg* p_heap)
+{
+    HeapStats xStats;
+    size_t i;
+
+    Heap_GetStats(p_heap, &xStats);
+    printf("HEAP: %u bytes, %u in use, peak %u, %u free\n",
+        xStats.xTotalBytes, xStats.xTotalBytes - xStats.xFreeBytes, xStats.xPeakUsedBytes, xStats.xFreeBytes);
+    printf("HEAP: %u allocations, %u frees\n",
+        p_heap->HeapNumberOfSuccessfulAllocations, p_heap->HeapNumberOfSuccessfulFrees);
+    printf("HEAP: %u free blocks, largest %u, fragmentation %u%%\n",
+        xStats.xLargeFreeBlocks, xStats.xLargestFreeBlock, xStats.xFragmentation);
+    printf("HEAP: slabs %u bytes, %u free, %u free small blocks\n",
+        xStats.xSlabBytes, xStats.xSlabFreeBytes, xStats.xSmallFreeBlocks);
+
+    printf("HEAP: %10s %10s %10s\n", "size", "allocs", "live");
+    for (i = 0; i < HEAP_SIZE_CLASSES; i++)
     {
-        pxIterator->xBlockSize += pxBlockToInsert->xBlockSize;
-        pxBlockToInsert = pxIterator;
+        if (p_heap->xClassAllocations[i] != 0)
+        {
+            printf("HEAP: %10u %10u %10u\n", HeapClassSizes[i], p_heap->xClassAllocations[i], p_heap->xClassLive[i]);
+        }
     }
-
-    /* Do the block being inserted, and the block it is being inserted before
-     * make a contiguous block of memory? */
-    puc = (uint8_t*)pxBlockToInsert;
-
-    if ((puc + pxBlockToInsert->xBlockSize) == (uint8_t*)heapPROTECT_BLOCK_POINTER(pxIterator->pxNextFreeBlock))
+    for (i = 0; i < HEAP_BINS; i++)
     {
-        if (heapPROTECT_BLOCK_POINTER(pxIterator->pxNextFreeBlock) != p_heap->pHeapEnd)
+        if (p_heap->xBinAllocations[i] != 0)
         {
-            /* Form one big block from the two blocks. */
-            pxBlockToInsert->xBlockSize += heapPROTECT_BLOCK_POINTER(pxIterator->pxNextFreeBlock)->xBlockSize;
-            pxBlockToInsert->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER(pxIterator->pxNextFreeBlock)->pxNextFreeBlock;
+            printf("HEAP: %9u+ %10u %10u\n", ((size_t)1) << i, p_heap->xBinAllocations[i], p_heap->xBinLive[i]);
         }
-        else
+    }
+
+    printf("HEAP: %10s %10s %10s\n", "caller", "allocs", "bytes");
+    for (i = 0; i < HEAP_SITES; i++)
+    {
+        if (p_heap->xSites[i].xAllocations != 0)
         {
-            pxBlockToInsert->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER(p_heap->pHeapEnd);
+            printf("HEAP: %10p %10u %10u\n", p_heap->xSites[i].pvCaller,
+                p_heap->xSites[i].xAllocations, p_heap->xSites[i].xRequestedBytes);
         }
     }
-    else
+    if (p_heap->xOtherSiteAllocations != 0)
     {
-        pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock;
+        printf("HEAP: %10s %10u\n", "other", p_heap->xOtherSiteAllocations);
     }
+}
+/*-----------------------------------------------------------*/
+
+void* Heap_Calloc(HeapCfg* p_heap, size_t xNum, size_t xSize)
+{
+    void* pv = NULL;
 
-    /* If the block being inserted plugged a gap, so was merged with the block
-     * before and the block after, then it's pxNextFreeBlock pointer will have
-     * already been set, and should not be set here as that would make it point
-     * to itself. */
-    if (pxIterator != pxBlockToInsert)
+    if (heapMULTIPLY_WILL_OVERFLOW(xNum, xSize) == 0)
     {
-        pxIterator->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER(pxBlockToInsert);
+        pv = Heap_MallocAt(p_heap, xNum * xSize, __builtin_return_address(0));
+
+        if (pv != NULL)
+        {
+            (void)memset(pv, 0, xNum * xSize);
+        }
     }
+
+    return pv;
 }
 /*-----------------------------------------------------------*/
 
 void Heap_DefineHeapRegions(HeapCfg* p_heap, const HeapRegion* const pxHeapRegions)
 {
     HeapBlockLink* pxFirstFreeBlockInRegion = NULL;
-    HeapBlockLink* pxPreviousFreeBlock;
     portPOINTER_SIZE_TYPE xAlignedHeap;
     size_t xTotalRegionSize, xTotalHeapSize = 0;
     int xDefinedRegions = 0;
@@ -443,58 +697,31 @@ void Heap_DefineHeapRegions(HeapCfg* p_heap, const HeapRegion* const pxHeapRegio
 
         xAlignedHeap = xAddress;
 
-        /* Set p_heap->HeapStart if it has not already been set. */
-        if (xDefinedRegions == 0)
-        {
-            /* p_heap->HeapStart is used to hold a pointer to the first item in the list of
-             *  free blocks.  The void cast is used to prevent compiler warnings. */
-            p_heap->HeapStart.pxNextFreeBlock = (HeapBlockLink*)heapPROTECT_BLOCK_POINTER(xAlignedHeap);
-            p_heap->HeapStart.xBlockSize = (size_t)0;
-        }
-        else
-        {
-            /* Should only get here if one region has already been added to the
-             * heap. */
-            HEAP_ASSERT(p_heap->pHeapEnd != heapPROTECT_BLOCK_POINTER(NULL));
-
-            /* Check blocks are passed in with increasing start addresses. */
-            HEAP_ASSERT((size_t)xAddress > (size_t)p_heap->pHeapEnd);
-        }
-
-        /* Remember the location of the end marker in the previous region, if
-         * any. */
-        pxPreviousFreeBlock = p_heap->pHeapEnd;
+        /* Check blocks are passed in with increasing start addresses. */
+        HEAP_ASSERT(p_heap->pHeapEnd == NULL || (size_t)xAddress > (size_t)p_heap->pHeapEnd);
 
-        /* p_heap->pHeapEnd is used to mark the end of the list of free blocks and is
-         * inserted at the end of the region space. */
+        /* p_heap->pHeapEnd marks the end of the region: an allocated block
+         * of size 0 that stops the merging of free blocks. */
         xAddress = xAlignedHeap + (portPOINTER_SIZE_TYPE)xTotalRegionSize;
         xAddress -= (portPOINTER_SIZE_TYPE)HEAP_STRUCT_SIZE;
         xAddress &= ~((portPOINTER_SIZE_TYPE)HEAP_BYTE_ALIGNMENT_MASK);
         p_heap->pHeapEnd = (HeapBlockLink*)xAddress;
-        p_heap->pHeapEnd->xBlockSize = 0;
-        p_heap->pHeapEnd->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER(NULL);
+        p_heap->pHeapEnd->xBlockSize = heapBLOCK_ALLOCATED_BITMASK;
+        p_heap->pHeapEnd->pxNextFreeBlock = NULL;
 
         /* To start with there is a single free block in this region that is
-         * sized to take up the entire heap region minus the space taken by the
-         * free block structure. */
+         * sized to take up the entire heap region minus the end marker. */
         pxFirstFreeBlockInRegion = (HeapBlockLink*)xAlignedHeap;
-        pxFirstFreeBlockInRegion->xBlockSize = (size_t)(xAddress - (portPOINTER_SIZE_TYPE)pxFirstFreeBlockInRegion);
-        pxFirstFreeBlockInRegion->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER(p_heap->pHeapEnd);
+        Heap_InsertFreeBlock(p_heap, pxFirstFreeBlockInRegion, (size_t)(xAddress - xAlignedHeap));
 
-        /* If this is not the first region that makes up the entire heap space
-         * then link the previous region to this region. */
-        if (pxPreviousFreeBlock != NULL)
-        {
-            pxPreviousFreeBlock->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER(pxFirstFreeBlockInRegion);
-        }
-
-        xTotalHeapSize += pxFirstFreeBlockInRegion->xBlockSize;
+        xTotalHeapSize += heapBLOCK_SIZE(pxFirstFreeBlockInRegion);
 
         /* Move onto the next HeapRegion_t structure. */
         xDefinedRegions++;
         pxHeapRegion = &(pxHeapRegions[xDefinedRegions]);
     }
 
+    p_heap->HeapTotalBytes = xTotalHeapSize;
     p_heap->HeapMinimumEverFreeBytesRemaining = xTotalHeapSize;
     p_heap->HeapFreeBytesRemaining = xTotalHeapSize;
 
@@ -504,17 +731,23 @@ void Heap_DefineHeapRegions(HeapCfg* p_heap, const HeapRegion* const pxHeapRegio
 
 /*
  * Reset the state in this file. This state is normally initialized at start up.
- * This function must be called by the application before restarting the
- * scheduler.
+ * This function must be called by the application before defining the regions.
  */
 void Heap_ResetState(HeapCfg* p_heap)
 {
-    p_heap->pHeapEnd = NULL;
+    size_t xSize;
+    int xClass = 0;
+
+    memset(p_heap, 0, sizeof(*p_heap));
 
-    p_heap->HeapFreeBytesRemaining = (size_t)0U;
-    p_heap->HeapMinimumEverFreeBytesRemaining = (size_t)0U;
-    p_heap->HeapNumberOfSuccessfulAllocations = (size_t)0U;
-    p_heap->HeapNumberOfSuccessfulFrees = (size_t)0U;
+    for (xSize = 16; xSize <= HEAP_SMALL_MAX; xSize += 16)
+    {
+        while (HeapClassSizes[xClass] < xSize)
+        {
+            xClass++;
+        }
+        HeapClassOfSize[(xSize - 1) / 16] = (uint8_t)xClass;
+    }
 }
 
 HeapCfg g_Heap;
@@ -522,8 +755,8 @@ void EnvHeapSetup()
 {
     const HeapRegion g_xHeapRegions[] =
     {
-    { ( uint8_t * ) g_DoomHeapAddress, g_DoomHeapSize }, 
-    { NULL, 0 }                
+    { ( uint8_t * ) g_DoomHeapAddress, g_DoomHeapSize },
+    { NULL, 0 }
     };
     Heap_ResetState(&g_Heap);
     Heap_DefineHeapRegions(&g_Heap,  (const HeapRegion* const)&g_xHeapRegions);
@@ -536,5 +769,15 @@ void EnvHeapFree(void* pv)
 
 void* EnvHeapMalloc(size_t xWantedSize)
 {
-    return Heap_Malloc(&g_Heap, xWantedSize);
+    return Heap_MallocAt(&g_Heap, xWantedSize, __builtin_return_address(0));
+}
+
+void* EnvHeapMallocAt(size_t xWantedSize, const void* pvCaller)
+{
+    return Heap_MallocAt(&g_Heap, xWantedSize, pvCaller);
+}
+
+void EnvHeapReport()
+{
+    Heap_Report(&g_Heap);
 }
@@ -0,0 +1,441 @@
+/* Native tests of the crt heap: heap_tests runs them and exits with the
+ * number of failures. heap.c is included for HeapCfg and its helpers; it
+ * brings the crt's own size_t, so no system header comes in here. */
+
+#include "heap.c"
+
+int putchar(int c);
+
+void *g_DoomHeapAddress = NULL;
+unsigned int g_DoomHeapSize = 0;
+
+static int g_Failures = 0;
+
+#define HEAP_CHECK(cond) \
+    if (!(cond)) { printf("FAILED\n  %s:%d: %s\n", __FILE__, __LINE__, #cond); g_Failures++; return; }
+
+/* Output of the heap while g_OutputLength is not negative */
+static char g_Output[4096];
+static int g_OutputLength = -1;
+
+void EnvPutChar(int c)
+{
+    if (g_OutputLength < 0)
+    {
+        putchar(c);
+    }
+    else if (g_OutputLength < (int)sizeof(g_Output) - 1)
+    {
+        g_Output[g_OutputLength++] = (char)c;
+        g_Output[g_OutputLength] = 0;
+    }
+}
+
+void *crtdoom_memset(void *addr, int val, int len)
+{
+    uint8_t *p = (uint8_t*)addr;
+    while (len-- > 0)
+    {
+        *p++ = (uint8_t)val;
+    }
+    return addr;
+}
+
+static uint8_t g_TestRegion[0x40000] __attribute__((aligned(8)));
+
+static void test_setup(HeapCfg *p_heap)
+{
+    HeapRegion regions[] =
+    {
+        { g_TestRegion, sizeof(g_TestRegion) },
+        { NULL, 0 }
+    };
+    Heap_ResetState(p_heap);
+    Heap_DefineHeapRegions(p_heap, regions);
+}
+
+/* An allocation of xBlockSize bytes, header included */
+static void *test_malloc_block(HeapCfg *p_heap, size_t xBlockSize)
+{
+    return Heap_Malloc(p_heap, xBlockSize - HEAP_STRUCT_SIZE);
+}
+
+/* The only block that fits sits behind more than HEAP_BIN_SCAN blocks of
+ * its bin that are too small, and every higher bin is empty. */
+static void test_large_own_bin_rest(void)
+{
+    HeapCfg heap;
+    HeapStats stats;
+    void *fit;
+    void *small[HEAP_BIN_SCAN + 2];
+    void *got;
+    int i;
+
+    printf("Running test_large_own_bin_rest... ");
+    test_setup(&heap);
+
+    /* Allocated spacers keep the free blocks from merging */
+    fit = test_malloc_block(&heap, 8000);
+    HEAP_CHECK(fit != NULL);
+    HEAP_CHECK(test_malloc_block(&heap, 3000) != NULL);
+    for (i = 0; i < HEAP_BIN_SCAN + 2; i++)
+    {
+        small[i] = test_malloc_block(&heap, 4500);
+        HEAP_CHECK(small[i] != NULL);
+        HEAP_CHECK(test_malloc_block(&heap, 3000) != NULL);
+    }
+
+    /* Use up the rest, so that no bin above 4096..8191 has a block */
+    for (;;)
+    {
+        Heap_GetStats(&heap, &stats);
+        if (stats.xLargestFreeBlock < 4096)
+        {
+            break;
+        }
+        HEAP_CHECK(test_malloc_block(&heap, stats.xLargestFreeBlock) != NULL);
+    }
+
+    /* Bins are LIFO: the small blocks end up in front of the one that fits */
+    Heap_Free(&heap, fit);
+    for (i = 0; i < HEAP_BIN_SCAN + 2; i++)
+    {
+        Heap_Free(&heap, small[i]);
+    }
+    Heap_GetStats(&heap, &stats);
+    HEAP_CHECK(stats.xLargestFreeBlock == 8000);
+
+    got = test_malloc_block(&heap, 7000);
+    HEAP_CHECK(got == fit);
+    printf("OK\n");
+}
+
+/* Blocks of a higher bin come before a long own bin */
+static void test_large_higher_bin(void)
+{
+    HeapCfg heap;
+    void *big;
+    void *small[HEAP_BIN_SCAN + 2];
+    void *got;
+    int i;
+
+    printf("Running test_large_higher_bin... ");
+    test_setup(&heap);
+
+    big = test_malloc_block(&heap, 16000);
+    HEAP_CHECK(big != NULL);
+    HEAP_CHECK(test_malloc_block(&heap, 3000) != NULL);
+    for (i = 0; i < HEAP_BIN_SCAN + 2; i++)
+    {
+        small[i] = test_malloc_block(&heap, 4500);
+        HEAP_CHECK(small[i] != NULL);
+        HEAP_CHECK(test_malloc_block(&heap, 3000) != NULL);
+    }
+    Heap_Free(&heap, big);
+    for (i = 0; i < HEAP_BIN_SCAN + 2; i++)
+    {
+        Heap_Free(&heap, small[i]);
+    }
+
+    got = test_malloc_block(&heap, 7000);
+    HEAP_CHECK(got == big);
+    printf("OK\n");
+}
+
+static HeapBlockLink *test_header(void *pv)
+{
+    return (HeapBlockLink*)(((uint8_t*)pv) - HEAP_STRUCT_SIZE);
+}
+
+/* Small blocks are carved one after the other from a slab of their class,
+ * a full slab is followed by a new one, and freed blocks come back LIFO */
+static void test_small_slab(void)
+{
+    HeapCfg heap;
+    HeapStats stats;
+    void *block[HEAP_SLAB_SIZE / 2048 + 1];
+    void *a, *b, *c;
+    size_t i;
+
+    printf("Running test_small_slab... ");
+    test_setup(&heap);
+
+    /* 40 and 48 bytes both round up to the 64-byte class */
+    a = Heap_Malloc(&heap, 40);
+    b = Heap_Malloc(&heap, 48);
+    c = test_malloc_block(&heap, 64);
+    HEAP_CHECK(a != NULL && b != NULL && c != NULL);
+    HEAP_CHECK((uint8_t*)b == (uint8_t*)a + 64);
+    HEAP_CHECK((uint8_t*)c == (uint8_t*)b + 64);
+    HEAP_CHECK(heapBLOCK_SIZE(test_header(a)) == 64);
+    Heap_GetStats(&heap, &stats);
+    HEAP_CHECK(stats.xSlabBytes == HEAP_SLAB_SIZE);
+
+    /* The last one freed is the first one handed out again */
+    Heap_Free(&heap, a);
+    Heap_Free(&heap, c);
+    Heap_GetStats(&heap, &stats);
+    HEAP_CHECK(stats.xSmallFreeBlocks == 2);
+    HEAP_CHECK(Heap_Malloc(&heap, 45) == c);
+    HEAP_CHECK(Heap_Malloc(&heap, 33) == a);
+    HEAP_CHECK((uint8_t*)Heap_Malloc(&heap, 48) == (uint8_t*)c + 64);
+
+    /* Another class has a slab of its own, which fills up */
+    for (i = 0; i < sizeof(block) / sizeof(block[0]); i++)
+    {
+        block[i] = test_malloc_block(&heap, 2048);
+        HEAP_CHECK(block[i] != NULL);
+    }
+    for (i = 1; i < (HEAP_SLAB_SIZE - HEAP_STRUCT_SIZE) / 2048; i++)
+    {
+        HEAP_CHECK((uint8_t*)block[i] == (uint8_t*)block[i - 1] + 2048);
+    }
+    Heap_GetStats(&heap, &stats);
+    HEAP_CHECK(stats.xSlabBytes == 3 * HEAP_SLAB_SIZE);
+    printf("OK\n");
+}
+
+/* Freeing a block between two free ones merges all three: the one before
+ * through HEAP_PREV_FREE and its footer, the one after through its header */
+static void test_large_merge(void)
+{
+    HeapCfg heap;
+    HeapStats stats;
+    void *a, *b, *c, *d;
+
+    printf("Running test_large_merge... ");
+    test_setup(&heap);
+
+    a = test_malloc_block(&heap, 5000);
+    b = test_malloc_block(&heap, 5000);
+    c = test_malloc_block(&heap, 5000);
+    d = test_malloc_block(&heap, 5000);
+    HEAP_CHECK(a != NULL && b != NULL && c != NULL && d != NULL);
+
+    Heap_Free(&heap, a);
+    HEAP_CHECK(test_header(b)->xBlockSize & HEAP_PREV_FREE);
+    HEAP_CHECK(*Heap_Footer(test_header(a)) == 5000);
+    Heap_Free(&heap, c);
+    HEAP_CHECK(test_header(d)->xBlockSize & HEAP_PREV_FREE);
+    Heap_GetStats(&heap, &stats);
+    HEAP_CHECK(stats.xLargeFreeBlocks == 3);
+
+    Heap_Free(&heap, b);
+    Heap_GetStats(&heap, &stats);
+    HEAP_CHECK(stats.xLargeFreeBlocks == 2);
+    HEAP_CHECK(heapBLOCK_SIZE(test_header(a)) == 15000);
+    HEAP_CHECK(*Heap_Footer(test_header(a)) == 15000);
+    HEAP_CHECK(test_header(d)->xBlockSize & HEAP_PREV_FREE);
+
+    /* The merged block is the one that serves a request of its size */
+    HEAP_CHECK(test_malloc_block(&heap, 15000) == a);
+    HEAP_CHECK(!(test_header(d)->xBlockSize & HEAP_PREV_FREE));
+    printf("OK\n");
+}
+
+/* After everything is freed the free bytes are back where they started,
+ * less the slab headers and tails: slabs are never given back */
+static void test_free_bytes_return(void)
+{
+    static const size_t xLargeSizes[] = { 3000, 9000, 2056, 40000, 5000, 12000 };
+    static const size_t xSmallSizes[] = { 64, 2048 };
+    HeapCfg heap;
+    HeapStats stats;
+    void *large[sizeof(xLargeSizes) / sizeof(xLargeSizes[0])];
+    void *small[2][HEAP_SLAB_SIZE / 2048 + 1];
+    size_t xStart, xSlabOverhead = 0;
+    size_t i, k;
+
+    printf("Running test_free_bytes_return... ");
+    test_setup(&heap);
+    xStart = Heap_GetFreeHeapSize(&heap);
+
+    for (i = 0; i < sizeof(large) / sizeof(large[0]); i++)
+    {
+        large[i] = test_malloc_block(&heap, xLargeSizes[i]);
+        HEAP_CHECK(large[i] != NULL);
+    }
+    /* Every other one first, so that the rest merge on both sides */
+    for (i = 0; i < sizeof(large) / sizeof(large[0]); i += 2)
+    {
+        Heap_Free(&heap, large[i]);
+    }
+    for (i = 1; i < sizeof(large) / sizeof(large[0]); i += 2)
+    {
+        Heap_Free(&heap, large[i]);
+    }
+    Heap_GetStats(&heap, &stats);
+    HEAP_CHECK(Heap_GetFreeHeapSize(&heap) == xStart);
+    HEAP_CHECK(stats.xLargeFreeBlocks == 1);
+    HEAP_CHECK(stats.xLargestFreeBlock == xStart);
+
+    for (k = 0; k < 2; k++)
+    {
+        for (i = 0; i < sizeof(small[k]) / sizeof(small[k][0]); i++)
+        {
+            small[k][i] = test_malloc_block(&heap, xSmallSizes[k]);
+            HEAP_CHECK(small[k][i] != NULL);
+        }
+        xSlabOverhead += HEAP_STRUCT_SIZE + (HEAP_SLAB_SIZE - HEAP_STRUCT_SIZE) % xSmallSizes[k];
+    }
+    /* The 2048 class filled its first slab */
+    xSlabOverhead += HEAP_STRUCT_SIZE + (HEAP_SLAB_SIZE - HEAP_STRUCT_SIZE) % 2048;
+    for (k = 0; k < 2; k++)
+    {
+        for (i = 0; i < sizeof(small[k]) / sizeof(small[k][0]); i++)
+        {
+            Heap_Free(&heap, small[k][i]);
+        }
+    }
+    Heap_GetStats(&heap, &stats);
+    HEAP_CHECK(stats.xSlabBytes == 3 * HEAP_SLAB_SIZE);
+    HEAP_CHECK(Heap_GetFreeHeapSize(&heap) == xStart - xSlabOverhead);
+    HEAP_CHECK(heap.HeapNumberOfSuccessfulAllocations == heap.HeapNumberOfSuccessfulFrees);
+    printf("OK\n");
+}
+
+static HeapSite *test_site(HeapCfg *p_heap, const void *pvCaller)
+{
+    int i;
+
+    for (i = 0; i < HEAP_SITES; i++)
+    {
+        if (p_heap->xSites[i].xAllocations != 0 && p_heap->xSites[i].pvCaller == pvCaller)
+        {
+            return &p_heap->xSites[i];
+        }
+    }
+    return NULL;
+}
+
+static int test_output_contains(const char *text)
+{
+    int i, k;
+
+    for (i = 0; i < g_OutputLength; i++)
+    {
+        for (k = 0; text[k] != 0 && g_Output[i + k] == text[k]; k++)
+        {
+        }
+        if (text[k] == 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* The histogram by class and bin, and the call-site table up to and past
+ * the point where it is full */
+static void test_stats_counts(void)
+{
+    const void *site_a = (const void *)0x1000;
+    const void *site_b = (const void *)0x2000;
+    HeapCfg heap;
+    HeapSite *site;
+    void *p_small, *p_large;
+    int class64, class128, bin;
+    int i;
+
+    printf("Running test_stats_counts... ");
+    test_setup(&heap);
+    class64 = HeapClassOfSize[(64 - 1) / 16];
+    class128 = HeapClassOfSize[(128 - 1) / 16];
+    bin = Heap_Log2(5000 + HEAP_STRUCT_SIZE);
+
+    p_small = Heap_MallocAt(&heap, 40, site_a);
+    HEAP_CHECK(Heap_MallocAt(&heap, 100, site_a) != NULL);
+    p_large = Heap_MallocAt(&heap, 5000, site_b);
+    HEAP_CHECK(p_small != NULL && p_large != NULL);
+    HEAP_CHECK(heap.xClassAllocations[class64] == 1 && heap.xClassLive[class64] == 1);
+    HEAP_CHECK(heap.xClassAllocations[class128] == 1 && heap.xClassLive[class128] == 1);
+    HEAP_CHECK(heap.xBinAllocations[bin] == 1 && heap.xBinLive[bin] == 1);
+
+    Heap_Free(&heap, p_small);
+    Heap_Free(&heap, p_large);
+    HEAP_CHECK(heap.xClassAllocations[class64] == 1 && heap.xClassLive[class64] == 0);
+    HEAP_CHECK(heap.xClassLive[class128] == 1);
+    HEAP_CHECK(heap.xBinAllocations[bin] == 1 && heap.xBinLive[bin] == 0);
+
+    /* The sites count the requested bytes, not the block sizes */
+    site = test_site(&heap, site_a);
+    HEAP_CHECK(site != NULL && site->xAllocations == 2 && site->xRequestedBytes == 140);
+    site = test_site(&heap, site_b);
+    HEAP_CHECK(site != NULL && site->xAllocations == 1 && site->xRequestedBytes == 5000);
+
+    /* Fill the table; a new site after that only counts as "other" */
+    for (i = 0; i < HEAP_SITES - 2; i++)
+    {
+        HEAP_CHECK(Heap_MallocAt(&heap, 8, (const void *)(portPOINTER_SIZE_TYPE)(0x10000 + 4 * i)) != NULL);
+    }
+    HEAP_CHECK(heap.xOtherSiteAllocations == 0);
+    HEAP_CHECK(Heap_MallocAt(&heap, 8, (const void *)0x3000) != NULL);
+    HEAP_CHECK(heap.xOtherSiteAllocations == 1);
+    HEAP_CHECK(test_site(&heap, (const void *)0x3000) == NULL);
+    HEAP_CHECK(Heap_MallocAt(&heap, 8, site_a) != NULL);
+    HEAP_CHECK(heap.xOtherSiteAllocations == 1);
+    HEAP_CHECK(test_site(&heap, site_a)->xAllocations == 3);
+    printf("OK\n");
+}
+
+/* Peak usage, the free blocks and the fragmentation, and the failure
+ * message, which names the size that was asked for */
+static void test_stats_usage(void)
+{
+    HeapCfg heap;
+    HeapStats stats;
+    void *a, *b, *peak;
+    int found;
+
+    printf("Running test_stats_usage... ");
+    test_setup(&heap);
+    Heap_GetStats(&heap, &stats);
+    HEAP_CHECK(stats.xTotalBytes == stats.xFreeBytes);
+    HEAP_CHECK(stats.xPeakUsedBytes == 0);
+    HEAP_CHECK(stats.xLargeFreeBlocks == 1 && stats.xFragmentation == 0);
+
+    peak = test_malloc_block(&heap, 20000);
+    HEAP_CHECK(peak != NULL);
+    Heap_Free(&heap, peak);
+    Heap_GetStats(&heap, &stats);
+    HEAP_CHECK(stats.xPeakUsedBytes == 20000);
+
+    /* Two free blocks of 6000 and 4000 bytes and nothing else free */
+    a = test_malloc_block(&heap, 6000);
+    HEAP_CHECK(test_malloc_block(&heap, 3000) != NULL);
+    b = test_malloc_block(&heap, 4000);
+    HEAP_CHECK(test_malloc_block(&heap, 3000) != NULL);
+    Heap_GetStats(&heap, &stats);
+    HEAP_CHECK(test_malloc_block(&heap, stats.xLargestFreeBlock) != NULL);
+    HEAP_CHECK(a != NULL && b != NULL);
+    Heap_Free(&heap, a);
+    Heap_Free(&heap, b);
+    Heap_GetStats(&heap, &stats);
+    HEAP_CHECK(stats.xPeakUsedBytes == stats.xTotalBytes);
+    HEAP_CHECK(stats.xFreeBytes == 10000);
+    HEAP_CHECK(stats.xLargeFreeBytes == 10000 && stats.xLargeFreeBlocks == 2);
+    HEAP_CHECK(stats.xLargestFreeBlock == 6000);
+    HEAP_CHECK(stats.xSlabBytes == 0 && stats.xSlabFreeBytes == 0);
+    HEAP_CHECK(stats.xFragmentation == 40);
+
+    /* The checks print through EnvPutChar as well: capture the call only */
+    g_OutputLength = 0;
+    a = Heap_Malloc(&heap, 9999);
+    found = test_output_contains("FAILED TO ALLOCATE 9999!");
+    g_OutputLength = -1;
+    HEAP_CHECK(a == NULL);
+    HEAP_CHECK(found);
+    printf("OK\n");
+}
+
+int main(void)
+{
+    test_large_own_bin_rest();
+    test_large_higher_bin();
+    test_small_slab();
+    test_large_merge();
+    test_free_bytes_return();
+    test_stats_counts();
+    test_stats_usage();
+    return g_Failures;
+}
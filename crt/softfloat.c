@@ -0,0 +1,609 @@
+/*
+ * IEEE 754 single and double precision on integers: the runtime of
+ * tcc -msoft-float. The entry points have the libgcc names and take and
+ * return bit patterns (float as uint32_t, double as uint64_t), so calls
+ * use the plain integer ABI. Rounding is to nearest even.
+ *
+ * Grown out of draft/softfloat_32.c. Every operation first checks that
+ * both operands are normal numbers and then goes straight to the
+ * significand arithmetic; NaN, infinity and zero are only looked at when
+ * that check fails, and subnormal operands are normalized on the way in.
+ *
+ * The rounding helpers take a significand whose top bit sits one below
+ * the word's top bit (bit 30 / bit 62) together with the biased exponent
+ * minus one: packing adds the hidden bit into the exponent field.
+ */
+
+#include "doom_crt.h"
+
+#define F32_SIGN 0x80000000u
+#define F32_INF 0x7F800000u
+#define F32_QNAN 0x7FC00000u
+#define F32_EXP(a) ((int) ((a) >> 23) & 0xFF)
+#define F32_IS_NAN(a) (((a) & ~F32_SIGN) > F32_INF)
+/* exponent neither 0 (zero, subnormal) nor 0xFF (infinity, NaN) */
+#define F32_NORMAL(a) ((uint32_t) (F32_EXP(a) - 1) < 0xFE)
+
+#define F64_SIGN 0x8000000000000000ull
+#define F64_INF 0x7FF0000000000000ull
+#define F64_QNAN 0x7FF8000000000000ull
+#define F64_EXP(a) ((int) ((a) >> 52) & 0x7FF)
+#define F64_IS_NAN(a) (((a) & ~F64_SIGN) > F64_INF)
+#define F64_NORMAL(a) ((uint32_t) (F64_EXP(a) - 1) < 0x7FE)
+
+static int clz32(uint32_t x)
+{
+    int n = 0;
+
+    if (!x)
+        return 32;
+    if (!(x & 0xFFFF0000u)) { n += 16; x <<= 16; }
+    if (!(x & 0xFF000000u)) { n += 8; x <<= 8; }
+    if (!(x & 0xF0000000u)) { n += 4; x <<= 4; }
+    if (!(x & 0xC0000000u)) { n += 2; x <<= 2; }
+    if (!(x & 0x80000000u)) { n += 1; }
+    return n;
+}
+
+static int clz64(uint64_t x)
+{
+    uint32_t hi = (uint32_t) (x >> 32);
+
+    return hi ? clz32(hi) : 32 + clz32((uint32_t) x);
+}
+
+/* x >> n with the lost bits ORed into bit 0 */
+static uint32_t shift_jam32(uint32_t x, int n)
+{
+    if (n <= 0)
+        return x;
+    if (n >= 31)
+        return x != 0;
+    return (x >> n) | ((x << (32 - n)) != 0);
+}
+
+static uint64_t shift_jam64(uint64_t x, int n)
+{
+    if (n <= 0)
+        return x;
+    if (n >= 63)
+        return x != 0;
+    return (x >> n) | ((x << (64 - n)) != 0);
+}
+
+/* ------------------------------------------------------------------ */
+/* single precision */
+
+/* biased exponent and significand with the hidden bit (bit 23) */
+static int f32_unpack(uint32_t a, uint32_t* sig)
+{
+    int exp = F32_EXP(a);
+    uint32_t frac = a & 0x007FFFFFu;
+    int shift;
+
+    if (exp) {
+        *sig = frac | 0x00800000u;
+        return exp;
+    }
+    shift = clz32(frac) - 8;
+    *sig = frac << shift;
+    return 1 - shift;
+}
+
+static uint32_t f32_round_pack(uint32_t sign, int exp, uint32_t sig)
+{
+    uint32_t round = sig & 0x7F;
+
+    if ((unsigned) exp >= 0xFD) {
+        if (exp < 0) {
+            /* subnormal result */
+            sig = shift_jam32(sig, -exp);
+            exp = 0;
+            round = sig & 0x7F;
+        } else if (exp > 0xFD || sig + 0x40 >= 0x80000000u) {
+            return sign | F32_INF;
+        }
+    }
+    sig = (sig + 0x40) >> 7;
+    if (round == 0x40)
+        sig &= ~1u; /* tie: to even */
+    return sign + ((uint32_t) exp << 23) + sig;
+}
+
+/* a + b, the sign of b is already flipped for a subtraction */
+static uint32_t f32_add(uint32_t a, uint32_t b)
+{
+    uint32_t sa, sb, sig, sign, t;
+    int ea, eb, shift;
+
+    if (!F32_NORMAL(a) || !F32_NORMAL(b)) {
+        if (F32_IS_NAN(a) || F32_IS_NAN(b))
+            return F32_QNAN;
+        if (F32_EXP(a) == 0xFF)
+            return F32_EXP(b) == 0xFF && ((a ^ b) & F32_SIGN) ? F32_QNAN : a;
+        if (F32_EXP(b) == 0xFF)
+            return b;
+        if (!(a << 1))
+            return (b << 1) ? b : a & b;
+        if (!(b << 1))
+            return a;
+    }
+    /* order by magnitude, the result has the sign of the larger one */
+    if ((a & ~F32_SIGN) < (b & ~F32_SIGN)) {
+        t = a;
+        a = b;
+        b = t;
+    }
+    sign = a & F32_SIGN;
+    ea = f32_unpack(a, &sa);
+    eb = f32_unpack(b, &sb);
+
+    if (!((a ^ b) & F32_SIGN)) {
+        sig = (sa << 6) + shift_jam32(sb << 6, ea - eb);
+        if (sig < 0x40000000u) {
+            sig <<= 1;
+            ea--;
+        }
+        return f32_round_pack(sign, ea, sig);
+    }
+    sig = (sa << 7) - shift_jam32(sb << 7, ea - eb);
+    if (!sig)
+        return 0;
+    shift = clz32(sig) - 1;
+    return f32_round_pack(sign, ea - 1 - shift, sig << shift);
+}
+
+uint32_t __addsf3(uint32_t a, uint32_t b)
+{
+    return f32_add(a, b);
+}
+
+uint32_t __subsf3(uint32_t a, uint32_t b)
+{
+    return f32_add(a, b ^ F32_SIGN);
+}
+
+uint32_t __mulsf3(uint32_t a, uint32_t b)
+{
+    uint32_t sign = (a ^ b) & F32_SIGN;
+    uint32_t sa, sb, sig;
+    uint64_t prod;
+    int exp;
+
+    if (!F32_NORMAL(a) || !F32_NORMAL(b)) {
+        if (F32_IS_NAN(a) || F32_IS_NAN(b))
+            return F32_QNAN;
+        if (F32_EXP(a) == 0xFF || F32_EXP(b) == 0xFF)
+            return (a << 1) && (b << 1) ? sign | F32_INF : F32_QNAN;
+        if (!(a << 1) || !(b << 1))
+            return sign;
+    }
+    exp = f32_unpack(a, &sa) + f32_unpack(b, &sb) - 0x7F;
+    prod = (uint64_t) (sa << 7) * (sb << 8);
+    sig = (uint32_t) (prod >> 32) | ((uint32_t) prod != 0);
+    if (sig < 0x40000000u) {
+        sig <<= 1;
+        exp--;
+    }
+    return f32_round_pack(sign, exp, sig);
+}
+
+uint32_t __divsf3(uint32_t a, uint32_t b)
+{
+    uint32_t sign = (a ^ b) & F32_SIGN;
+    uint32_t sa, sb, sig;
+    uint64_t num;
+    int exp;
+
+    if (!F32_NORMAL(a) || !F32_NORMAL(b)) {
+        if (F32_IS_NAN(a) || F32_IS_NAN(b))
+            return F32_QNAN;
+        if (F32_EXP(a) == 0xFF)
+            return F32_EXP(b) == 0xFF ? F32_QNAN : sign | F32_INF;
+        if (F32_EXP(b) == 0xFF)
+            return sign;
+        if (!(b << 1))
+            return (a << 1) ? sign | F32_INF : F32_QNAN;
+        if (!(a << 1))
+            return sign;
+    }
+    exp = f32_unpack(a, &sa) - f32_unpack(b, &sb) + 0x7E;
+    if (sa < sb) {
+        num = (uint64_t) sa << 31;
+        exp--;
+    } else {
+        num = (uint64_t) sa << 30;
+    }
+    sig = (uint32_t) (num / sb);
+    if (!(sig & 0x3F))
+        sig |= (uint64_t) sb * sig != num;
+    return f32_round_pack(sign, exp, sig);
+}
+
+/* -1, 0, 1 for a <, ==, > b; 'unordered' if either is a NaN */
+static int f32_cmp(uint32_t a, uint32_t b, int unordered)
+{
+    int32_t ka, kb;
+
+    if (F32_IS_NAN(a) || F32_IS_NAN(b))
+        return unordered;
+    /* sign-magnitude to two's complement, both zeros become 0 */
+    ka = (a & F32_SIGN) ? -(int32_t) (a & ~F32_SIGN) : (int32_t) a;
+    kb = (b & F32_SIGN) ? -(int32_t) (b & ~F32_SIGN) : (int32_t) b;
+    return (ka > kb) - (ka < kb);
+}
+
+int __eqsf2(uint32_t a, uint32_t b) { return f32_cmp(a, b, 1); }
+int __nesf2(uint32_t a, uint32_t b) { return f32_cmp(a, b, 1); }
+int __ltsf2(uint32_t a, uint32_t b) { return f32_cmp(a, b, 1); }
+int __lesf2(uint32_t a, uint32_t b) { return f32_cmp(a, b, 1); }
+int __gtsf2(uint32_t a, uint32_t b) { return f32_cmp(a, b, -1); }
+int __gesf2(uint32_t a, uint32_t b) { return f32_cmp(a, b, -1); }
+
+uint32_t __floatunsisf(uint32_t a)
+{
+    int shift;
+
+    if (!a)
+        return 0;
+    if (a & 0x80000000u)
+        return f32_round_pack(0, 0x9D, (a >> 1) | (a & 1));
+    shift = clz32(a) - 1;
+    return f32_round_pack(0, 0x9C - shift, a << shift);
+}
+
+uint32_t __floatsisf(int32_t a)
+{
+    uint32_t sign = a < 0 ? F32_SIGN : 0;
+
+    return sign | __floatunsisf(sign ? -(uint32_t) a : (uint32_t) a);
+}
+
+uint32_t __floatundisf(uint64_t a)
+{
+    int shift = clz64(a) - 40;
+    uint32_t sig;
+
+    if (shift >= 0)
+        return a ? ((uint32_t) (0x95 - shift) << 23) + ((uint32_t) a << shift) : 0;
+    shift += 7;
+    sig = (uint32_t) (shift < 0 ? shift_jam64(a, -shift) : a << shift);
+    return f32_round_pack(0, 0x9C - shift, sig);
+}
+
+uint32_t __floatdisf(int64_t a)
+{
+    uint32_t sign = a < 0 ? F32_SIGN : 0;
+
+    return sign | __floatundisf(sign ? -(uint64_t) a : (uint64_t) a);
+}
+
+/* |a| as an integer, truncated; 'max' limits the exponent */
+static uint64_t f32_to_int(uint32_t a, int max, uint64_t overflow)
+{
+    int exp = F32_EXP(a);
+    uint64_t sig = (a & 0x007FFFFFu) | 0x00800000u;
+
+    if (exp < 0x7F)
+        return 0;
+    if (exp >= max)
+        return overflow;
+    return exp >= 0x96 ? sig << (exp - 0x96) : sig >> (0x96 - exp);
+}
+
+/* out-of-range values give the x87 "integer indefinite" like the FPU path */
+int32_t __fixsfsi(uint32_t a)
+{
+    uint32_t v = (uint32_t) f32_to_int(a, 0x9E, 0x80000000u);
+
+    return (a & F32_SIGN) ? -v : v;
+}
+
+int64_t __fixsfdi(uint32_t a)
+{
+    uint64_t v = f32_to_int(a, 0xBE, F64_SIGN);
+
+    return (a & F32_SIGN) ? -v : v;
+}
+
+uint64_t __fixunssfdi(uint32_t a)
+{
+    if (a & F32_SIGN)
+        return 0;
+    return f32_to_int(a, 0xBF, ~0ull);
+}
+
+/* the FPU path converts unsigned int through long long as well */
+uint32_t __fixunssfsi(uint32_t a)
+{
+    return (uint32_t) __fixsfdi(a);
+}
+
+/* ------------------------------------------------------------------ */
+/* double precision */
+
+/* biased exponent and significand with the hidden bit (bit 52) */
+static int f64_unpack(uint64_t a, uint64_t* sig)
+{
+    int exp = F64_EXP(a);
+    uint64_t frac = a & 0x000FFFFFFFFFFFFFull;
+    int shift;
+
+    if (exp) {
+        *sig = frac | 0x0010000000000000ull;
+        return exp;
+    }
+    shift = clz64(frac) - 11;
+    *sig = frac << shift;
+    return 1 - shift;
+}
+
+static uint64_t f64_round_pack(uint64_t sign, int exp, uint64_t sig)
+{
+    uint32_t round = (uint32_t) sig & 0x3FF;
+
+    if ((unsigned) exp >= 0x7FD) {
+        if (exp < 0) {
+            sig = shift_jam64(sig, -exp);
+            exp = 0;
+            round = (uint32_t) sig & 0x3FF;
+        } else if (exp > 0x7FD || sig + 0x200 >= F64_SIGN) {
+            return sign | F64_INF;
+        }
+    }
+    sig = (sig + 0x200) >> 10;
+    if (round == 0x200)
+        sig &= ~1ull;
+    return sign + ((uint64_t) exp << 52) + sig;
+}
+
+static uint64_t f64_add(uint64_t a, uint64_t b)
+{
+    uint64_t sa, sb, sig, sign, t;
+    int ea, eb, shift;
+
+    if (!F64_NORMAL(a) || !F64_NORMAL(b)) {
+        if (F64_IS_NAN(a) || F64_IS_NAN(b))
+            return F64_QNAN;
+        if (F64_EXP(a) == 0x7FF)
+            return F64_EXP(b) == 0x7FF && ((a ^ b) & F64_SIGN) ? F64_QNAN : a;
+        if (F64_EXP(b) == 0x7FF)
+            return b;
+        if (!(a << 1))
+            return (b << 1) ? b : a & b;
+        if (!(b << 1))
+            return a;
+    }
+    if ((a & ~F64_SIGN) < (b & ~F64_SIGN)) {
+        t = a;
+        a = b;
+        b = t;
+    }
+    sign = a & F64_SIGN;
+    ea = f64_unpack(a, &sa);
+    eb = f64_unpack(b, &sb);
+
+    if (!((a ^ b) & F64_SIGN)) {
+        sig = (sa << 9) + shift_jam64(sb << 9, ea - eb);
+        if (sig < 0x4000000000000000ull) {
+            sig <<= 1;
+            ea--;
+        }
+        return f64_round_pack(sign, ea, sig);
+    }
+    sig = (sa << 10) - shift_jam64(sb << 10, ea - eb);
+    if (!sig)
+        return 0;
+    shift = clz64(sig) - 1;
+    return f64_round_pack(sign, ea - 1 - shift, sig << shift);
+}
+
+uint64_t __adddf3(uint64_t a, uint64_t b)
+{
+    return f64_add(a, b);
+}
+
+uint64_t __subdf3(uint64_t a, uint64_t b)
+{
+    return f64_add(a, b ^ F64_SIGN);
+}
+
+/* high 64 bits of a * b, *lo gets the low ones */
+static uint64_t mul64_hi(uint64_t a, uint64_t b, uint64_t* lo)
+{
+    uint32_t a0 = (uint32_t) a, a1 = (uint32_t) (a >> 32);
+    uint32_t b0 = (uint32_t) b, b1 = (uint32_t) (b >> 32);
+    uint64_t p00 = (uint64_t) a0 * b0;
+    uint64_t p01 = (uint64_t) a0 * b1;
+    uint64_t p10 = (uint64_t) a1 * b0;
+    uint64_t mid = (p00 >> 32) + (uint32_t) p01 + (uint32_t) p10;
+
+    *lo = (mid << 32) | (uint32_t) p00;
+    return (uint64_t) a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+}
+
+uint64_t __muldf3(uint64_t a, uint64_t b)
+{
+    uint64_t sign = (a ^ b) & F64_SIGN;
+    uint64_t sa, sb, sig, lo;
+    int exp;
+
+    if (!F64_NORMAL(a) || !F64_NORMAL(b)) {
+        if (F64_IS_NAN(a) || F64_IS_NAN(b))
+            return F64_QNAN;
+        if (F64_EXP(a) == 0x7FF || F64_EXP(b) == 0x7FF)
+            return (a << 1) && (b << 1) ? sign | F64_INF : F64_QNAN;
+        if (!(a << 1) || !(b << 1))
+            return sign;
+    }
+    exp = f64_unpack(a, &sa) + f64_unpack(b, &sb) - 0x3FF;
+    sig = mul64_hi(sa << 10, sb << 11, &lo);
+    sig |= lo != 0;
+    if (sig < 0x4000000000000000ull) {
+        sig <<= 1;
+        exp--;
+    }
+    return f64_round_pack(sign, exp, sig);
+}
+
+uint64_t __divdf3(uint64_t a, uint64_t b)
+{
+    uint64_t sign = (a ^ b) & F64_SIGN;
+    uint64_t sa, sb, q;
+    int exp, i;
+
+    if (!F64_NORMAL(a) || !F64_NORMAL(b)) {
+        if (F64_IS_NAN(a) || F64_IS_NAN(b))
+            return F64_QNAN;
+        if (F64_EXP(a) == 0x7FF)
+            return F64_EXP(b) == 0x7FF ? F64_QNAN : sign | F64_INF;
+        if (F64_EXP(b) == 0x7FF)
+            return sign;
+        if (!(b << 1))
+            return (a << 1) ? sign | F64_INF : F64_QNAN;
+        if (!(a << 1))
+            return sign;
+    }
+    exp = f64_unpack(a, &sa) - f64_unpack(b, &sb) + 0x3FE;
+    if (sa < sb) {
+        sa <<= 1;
+        exp--;
+    }
+    /* restoring division, one quotient bit per step down to bit 0 */
+    q = 0;
+    for (i = 0; i < 63; i++) {
+        q <<= 1;
+        if (sa >= sb) {
+            sa -= sb;
+            q |= 1;
+        }
+        sa <<= 1;
+    }
+    return f64_round_pack(sign, exp, q | (sa != 0));
+}
+
+static int f64_cmp(uint64_t a, uint64_t b, int unordered)
+{
+    int64_t ka, kb;
+
+    if (F64_IS_NAN(a) || F64_IS_NAN(b))
+        return unordered;
+    ka = (a & F64_SIGN) ? -(int64_t) (a & ~F64_SIGN) : (int64_t) a;
+    kb = (b & F64_SIGN) ? -(int64_t) (b & ~F64_SIGN) : (int64_t) b;
+    return (ka > kb) - (ka < kb);
+}
+
+int __eqdf2(uint64_t a, uint64_t b) { return f64_cmp(a, b, 1); }
+int __nedf2(uint64_t a, uint64_t b) { return f64_cmp(a, b, 1); }
+int __ltdf2(uint64_t a, uint64_t b) { return f64_cmp(a, b, 1); }
+int __ledf2(uint64_t a, uint64_t b) { return f64_cmp(a, b, 1); }
+int __gtdf2(uint64_t a, uint64_t b) { return f64_cmp(a, b, -1); }
+int __gedf2(uint64_t a, uint64_t b) { return f64_cmp(a, b, -1); }
+
+/* every int32 is exact in a double */
+uint64_t __floatunsidf(uint32_t a)
+{
+    int shift;
+
+    if (!a)
+        return 0;
+    shift = clz32(a) + 21;
+    return ((uint64_t) (0x432 - shift) << 52) + ((uint64_t) a << shift);
+}
+
+uint64_t __floatsidf(int32_t a)
+{
+    uint64_t sign = a < 0 ? F64_SIGN : 0;
+
+    return sign | __floatunsidf(sign ? -(uint32_t) a : (uint32_t) a);
+}
+
+uint64_t __floatundidf(uint64_t a)
+{
+    int shift;
+
+    if (!a)
+        return 0;
+    if (a & F64_SIGN)
+        return f64_round_pack(0, 0x43D, (a >> 1) | (a & 1));
+    shift = clz64(a) - 1;
+    return f64_round_pack(0, 0x43C - shift, a << shift);
+}
+
+uint64_t __floatdidf(int64_t a)
+{
+    uint64_t sign = a < 0 ? F64_SIGN : 0;
+
+    return sign | __floatundidf(sign ? -(uint64_t) a : (uint64_t) a);
+}
+
+static uint64_t f64_to_int(uint64_t a, int max, uint64_t overflow)
+{
+    int exp = F64_EXP(a);
+    uint64_t sig = (a & 0x000FFFFFFFFFFFFFull) | 0x0010000000000000ull;
+
+    if (exp < 0x3FF)
+        return 0;
+    if (exp >= max)
+        return overflow;
+    return exp >= 0x433 ? sig << (exp - 0x433) : sig >> (0x433 - exp);
+}
+
+int32_t __fixdfsi(uint64_t a)
+{
+    uint32_t v = (uint32_t) f64_to_int(a, 0x41E, 0x80000000u);
+
+    return (a & F64_SIGN) ? -v : v;
+}
+
+int64_t __fixdfdi(uint64_t a)
+{
+    uint64_t v = f64_to_int(a, 0x43E, F64_SIGN);
+
+    return (a & F64_SIGN) ? -v : v;
+}
+
+uint64_t __fixunsdfdi(uint64_t a)
+{
+    if (a & F64_SIGN)
+        return 0;
+    return f64_to_int(a, 0x43F, ~0ull);
+}
+
+uint32_t __fixunsdfsi(uint64_t a)
+{
+    return (uint32_t) __fixdfdi(a);
+}
+
+/* ------------------------------------------------------------------ */
+/* float <-> double */
+
+uint64_t __extendsfdf2(uint32_t a)
+{
+    uint64_t sign = (uint64_t) (a & F32_SIGN) << 32;
+    uint32_t sig;
+    int exp = F32_EXP(a);
+
+    if (exp == 0xFF)
+        return sign | F64_INF | ((uint64_t) (a & 0x007FFFFFu) << 29);
+    if (!(a << 1))
+        return sign;
+    exp = f32_unpack(a, &sig);
+    return sign | ((uint64_t) (exp + 0x380) << 52) | ((uint64_t) (sig & 0x007FFFFFu) << 29);
+}
+
+uint32_t __truncdfsf2(uint64_t a)
+{
+    uint32_t sign = (uint32_t) (a >> 32) & F32_SIGN;
+    uint64_t frac = a & 0x000FFFFFFFFFFFFFull;
+    uint32_t sig;
+    int exp = F64_EXP(a);
+
+    if (exp == 0x7FF)
+        return frac ? F32_QNAN : sign | F32_INF;
+    /* 52 fraction bits to 30, the rest goes into the sticky bit */
+    sig = (uint32_t) (frac >> 22) | ((frac & 0x3FFFFF) != 0);
+    if (!(exp | sig))
+        return sign;
+    return f32_round_pack(sign, exp - 0x381, sig | 0x40000000u);
+}
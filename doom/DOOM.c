@@ -16,6 +16,8 @@
 
 extern byte* screens[5];
 extern unsigned char screen_palette[256 * 3];
+extern unsigned int screen_palette_rgba[256];
+extern byte dirtyrows[SCREENHEIGHT];
 extern doom_boolean is_wiping_screen;
 extern default_t defaults[];
 extern int numdefaults;
@@ -24,6 +26,10 @@ extern signed short mixbuffer[2048];
 
 static unsigned char* screen_buffer = 0;
 static unsigned char* final_screen_buffer = 0;
+static unsigned int* blit_pixels = 0;
+static int blit_pitch = 0;
+static int blit_scale = 0;
+static int blit_crosshair = -1;
 static int last_update_time = 0;
 static int button_states[3] = { 0 };
 static char itoa_buf[20];
@@ -44,6 +50,7 @@ doom_eof_fn doom_eof = 0;
 doom_gettime_fn doom_gettime = 0;
 doom_exit_fn doom_exit = 0;
 doom_getenv_fn doom_getenv = 0;
+doom_map_fn doom_map = 0;
 
 
 void D_DoomLoop(void);
@@ -195,10 +202,46 @@ char* doom_getenv_impl(const char* var) {}
 #endif
 
 
+// Word at a time once the destination is aligned, 16 bytes at a time with
+// gcc and SSE2 (vector types, no intrinsics headers needed).
+#if defined(__GNUC__) && !defined(__TINYC__)
+typedef unsigned long __attribute__((__may_alias__)) doom_word_t;
+#if defined(__SSE2__)
+#define DOOM_VECTOR_COPY
+typedef unsigned char doom_vector_t __attribute__((__vector_size__(16), __aligned__(1), __may_alias__));
+#endif
+#else
+typedef unsigned long doom_word_t;
+#endif
+
+#define DOOM_WORD_SIZE ((int)sizeof(doom_word_t))
+#define DOOM_WORD_ALIGNED(p) (((unsigned long)(p) & (sizeof(doom_word_t) - 1)) == 0)
+
+
 void doom_memset(void* ptr, int value, int num)
 {
     unsigned char* p = ptr;
-    for (int i = 0; i < num; ++i, ++p)
+    doom_word_t word = (~(doom_word_t)0 / 0xff) * (unsigned char)value;
+
+    for (; num > 0 && !DOOM_WORD_ALIGNED(p); --num, ++p)
+    {
+        *p = (unsigned char)value;
+    }
+#if defined(DOOM_VECTOR_COPY)
+    {
+        doom_vector_t vector = { 0 };
+        vector += (unsigned char)value;
+        for (; num >= 16; num -= 16, p += 16)
+        {
+            *(doom_vector_t*)p = vector;
+        }
+    }
+#endif
+    for (; num >= DOOM_WORD_SIZE; num -= DOOM_WORD_SIZE, p += DOOM_WORD_SIZE)
+    {
+        *(doom_word_t*)p = word;
+    }
+    for (; num > 0; --num, ++p)
     {
         *p = (unsigned char)value;
     }
@@ -210,7 +253,21 @@ void* doom_memcpy(void* destination, const void* source, int num)
     unsigned char* dst = destination;
     const unsigned char* src = source;
 
-    for (int i = 0; i < num; ++i, ++dst, ++src)
+    for (; num > 0 && !DOOM_WORD_ALIGNED(dst); --num, ++dst, ++src)
+    {
+        *dst = *src;
+    }
+#if defined(DOOM_VECTOR_COPY)
+    for (; num >= 16; num -= 16, dst += 16, src += 16)
+    {
+        *(doom_vector_t*)dst = *(const doom_vector_t*)src;
+    }
+#endif
+    for (; num >= DOOM_WORD_SIZE; num -= DOOM_WORD_SIZE, dst += DOOM_WORD_SIZE, src += DOOM_WORD_SIZE)
+    {
+        *(doom_word_t*)dst = *(const doom_word_t*)src;
+    }
+    for (; num > 0; --num, ++dst, ++src)
     {
         *dst = *src;
     }
@@ -538,6 +595,12 @@ void doom_set_getenv(doom_getenv_fn getenv_fn)
 }
 
 
+void doom_set_file_map(doom_map_fn map_fn)
+{
+    doom_map = map_fn;
+}
+
+
 void doom_init(int argc, char** argv, int flags)
 {
     if (!doom_print) doom_print = doom_print_impl;
@@ -583,38 +646,106 @@ void doom_update()
 }
 
 
-const unsigned char* doom_get_framebuffer(int channels)
+// Palette lookup of count pixels, four per round
+static void expand_pixels(unsigned int* dst, const unsigned char* src, int count)
 {
-    int i, len;
+    for (; count >= 4; count -= 4, src += 4, dst += 4)
+    {
+        dst[0] = screen_palette_rgba[src[0]];
+        dst[1] = screen_palette_rgba[src[1]];
+        dst[2] = screen_palette_rgba[src[2]];
+        dst[3] = screen_palette_rgba[src[3]];
+    }
+    for (; count > 0; --count)
+    {
+        *dst++ = screen_palette_rgba[*src++];
+    }
+}
 
-    doom_memcpy(screen_buffer, screens[0], SCREENWIDTH * SCREENHEIGHT);
 
-    extern doom_boolean menuactive;
-    extern gamestate_t gamestate; 
-    extern doom_boolean automapactive;
-    extern int crosshair;
+// One frame row, every pixel scale times, cut at width
+static void expand_row(unsigned int* dst, const unsigned char* src, int width, int scale)
+{
+    int x, i;
 
-    // Draw crosshair
-    if (crosshair && 
-        !menuactive &&
-        gamestate == GS_LEVEL &&
-        !automapactive)
-    {
-        int y;
-        extern int setblocks;
-        if (setblocks == 11) y = SCREENHEIGHT / 2 + 8;
-        else y = SCREENHEIGHT / 2 - 8;
-        for (i = 0; i < 2; ++i)
+    if (scale == 1)
+    {
+        expand_pixels(dst, src, width);
+        return;
+    }
+    if (scale == 2)
+    {
+        for (x = 0; x + 2 <= width; x += 2)
         {
-            screen_buffer[SCREENWIDTH / 2 - 2 - i + y * SCREENWIDTH] = 4;
-            screen_buffer[SCREENWIDTH / 2 + 2 + i + y * SCREENWIDTH] = 4;
+            unsigned int color = screen_palette_rgba[*src++];
+            dst[x] = color;
+            dst[x + 1] = color;
         }
-        for (i = 0; i < 2; ++i)
+    }
+    else
+    {
+        for (x = 0; x + scale <= width; x += scale)
         {
-            screen_buffer[SCREENWIDTH / 2 + (y - 2 - i) * SCREENWIDTH] = 4;
-            screen_buffer[SCREENWIDTH / 2 + (y + 2 + i) * SCREENWIDTH] = 4;
+            unsigned int color = screen_palette_rgba[*src++];
+            for (i = 0; i < scale; ++i)
+                dst[x + i] = color;
         }
     }
+    for (; x < width; ++x)
+        dst[x] = screen_palette_rgba[*src];
+}
+
+
+// Offsets of the crosshair pixels in the frame, 0 when it is hidden
+#define CROSSHAIR_PIXELS 8
+static int get_crosshair(int* offsets)
+{
+    int i, y;
+
+    extern doom_boolean menuactive;
+    extern gamestate_t gamestate; 
+    extern doom_boolean automapactive;
+    extern int crosshair;
+    extern int setblocks;
+
+    if (!crosshair || 
+        menuactive ||
+        gamestate != GS_LEVEL ||
+        automapactive)
+        return 0;
+
+    if (setblocks == 11) y = SCREENHEIGHT / 2 + 8;
+    else y = SCREENHEIGHT / 2 - 8;
+    for (i = 0; i < 2; ++i)
+    {
+        *offsets++ = SCREENWIDTH / 2 - 2 - i + y * SCREENWIDTH;
+        *offsets++ = SCREENWIDTH / 2 + 2 + i + y * SCREENWIDTH;
+        *offsets++ = SCREENWIDTH / 2 + (y - 2 - i) * SCREENWIDTH;
+        *offsets++ = SCREENWIDTH / 2 + (y + 2 + i) * SCREENWIDTH;
+    }
+    return CROSSHAIR_PIXELS;
+}
+
+
+// screens[0] with the crosshair on top
+static void update_screen_buffer()
+{
+    int offsets[CROSSHAIR_PIXELS];
+    int i, count;
+
+    doom_memcpy(screen_buffer, screens[0], SCREENWIDTH * SCREENHEIGHT);
+
+    count = get_crosshair(offsets);
+    for (i = 0; i < count; ++i)
+        screen_buffer[offsets[i]] = 4;
+}
+
+
+const unsigned char* doom_get_framebuffer(int channels)
+{
+    int i, len;
+
+    update_screen_buffer();
 
     if (channels == 1)
     {
@@ -624,25 +755,17 @@ const unsigned char* doom_get_framebuffer(int channels)
     {
         for (i = 0, len = SCREENWIDTH * SCREENHEIGHT; i < len; ++i)
         {
+            const unsigned char* color = (const unsigned char*)&screen_palette_rgba[screen_buffer[i]];
             int k = i * 3;
-            int kpal = screen_buffer[i] * 3;
-            final_screen_buffer[k + 2] = screen_palette[kpal + 0];
-            final_screen_buffer[k + 1] = screen_palette[kpal + 1];
-            final_screen_buffer[k + 0] = screen_palette[kpal + 2];
+            final_screen_buffer[k + 0] = color[0];
+            final_screen_buffer[k + 1] = color[1];
+            final_screen_buffer[k + 2] = color[2];
         }
         return final_screen_buffer;
     }
     else if (channels == 4)
     {
-        for (i = 0, len = SCREENWIDTH * SCREENHEIGHT; i < len; ++i)
-        {
-            int k = i * 4;
-            int kpal = screen_buffer[i] * 3;
-            final_screen_buffer[k + 2] = screen_palette[kpal + 0];
-            final_screen_buffer[k + 1] = screen_palette[kpal + 1];
-            final_screen_buffer[k + 0] = screen_palette[kpal + 2];
-            final_screen_buffer[k + 3] = 255;
-        }
+        expand_pixels((unsigned int*)final_screen_buffer, screen_buffer, SCREENWIDTH * SCREENHEIGHT);
         return final_screen_buffer;
     }
     else
@@ -652,6 +775,150 @@ const unsigned char* doom_get_framebuffer(int channels)
 }
 
 
+void doom_blit_framebuffer(unsigned int* pixels, int width, int height, int pitch)
+{
+    void V_MarkRect(int x, int y, int width, int height);
+
+    V_MarkRect(0, 0, SCREENWIDTH, SCREENHEIGHT);
+    doom_blit_framebuffer_rows(pixels, width, height, pitch, 1, 0);
+}
+
+
+int doom_blit_framebuffer_rows(unsigned int* pixels, int width, int height, int pitch, int scale, unsigned char* rows)
+{
+    int offsets[CROSSHAIR_PIXELS];
+    int i, x, y, count, redrawn = 0;
+
+    void V_MarkRect(int x, int y, int width, int height);
+
+    if (!pixels || scale < 1) return 0;
+    if (width > SCREENWIDTH * scale) width = SCREENWIDTH * scale;
+    if (height > SCREENHEIGHT * scale) height = SCREENHEIGHT * scale;
+
+    // Another buffer holds none of the frame yet
+    if (pixels != blit_pixels || pitch != blit_pitch || scale != blit_scale)
+    {
+        V_MarkRect(0, 0, SCREENWIDTH, SCREENHEIGHT);
+        blit_pixels = pixels;
+        blit_pitch = pitch;
+        blit_scale = scale;
+    }
+
+    // The rows under the crosshair are redrawn when it shows, hides or moves
+    count = get_crosshair(offsets);
+    if ((count ? offsets[0] : -1) != blit_crosshair)
+    {
+        if (blit_crosshair >= 0)
+            V_MarkRect(0, blit_crosshair / SCREENWIDTH - 3, SCREENWIDTH, 7);
+        if (count)
+            V_MarkRect(0, offsets[0] / SCREENWIDTH - 3, SCREENWIDTH, 7);
+        blit_crosshair = count ? offsets[0] : -1;
+    }
+
+    // Straight from screens[0], one pass per row, then copies of it for
+    // the other scale - 1 pixel rows
+    for (y = 0; y < SCREENHEIGHT; ++y)
+    {
+        int top = y * scale;
+        int bottom = top + scale;
+
+        if (rows) rows[y] = dirtyrows[y];
+        if (!dirtyrows[y]) continue;
+        dirtyrows[y] = 0;
+        redrawn++;
+
+        if (top >= height) continue;
+        if (bottom > height) bottom = height;
+        expand_row(pixels + top * pitch, screens[0] + y * SCREENWIDTH, width, scale);
+        for (i = top + 1; i < bottom; ++i)
+            doom_memcpy(pixels + i * pitch, pixels + top * pitch, width * 4);
+    }
+
+    // The crosshair goes over the expanded pixels
+    for (i = 0; i < count; ++i)
+    {
+        int cx = offsets[i] % SCREENWIDTH * scale;
+        int cy = offsets[i] / SCREENWIDTH * scale;
+
+        for (y = cy; y < cy + scale && y < height; ++y)
+            for (x = cx; x < cx + scale && x < width; ++x)
+                pixels[y * pitch + x] = screen_palette_rgba[4];
+    }
+
+    return redrawn;
+}
+
+
+const unsigned int* doom_get_palette()
+{
+    return screen_palette_rgba;
+}
+
+
+int doom_timedemo(const char* demo, doom_gettime_fn clock_fn, doom_timedemo_t* result)
+{
+    extern doom_boolean demoplayback;
+    extern doom_boolean singledemo;
+    extern doom_boolean singletics;
+    extern gameaction_t gameaction;
+    extern int gametic;
+    void G_DeferedPlayDemo(char* name);
+    int W_CheckNumForName(char* name);
+
+    int started = 0;
+    int first_tic;
+    unsigned long long start, convert;
+
+    doom_memset(result, 0, sizeof(*result));
+
+    // G_DoPlayDemo would end in I_Error on a missing lump
+    if (W_CheckNumForName((char*)demo) == -1)
+        return -1;
+
+    doom_memset(profile_time, 0, sizeof(profile_time));
+    profile_clock = clock_fn ? clock_fn : doom_gettime;
+
+    // One tic per frame and no quitting at the end of the demo
+    singletics = true;
+    singledemo = false;
+    G_DeferedPlayDemo((char*)demo);
+
+    first_tic = gametic;
+    start = I_ProfileStart();
+    for (;;)
+    {
+        if (is_wiping_screen)
+            D_UpdateWipe();
+        else
+            D_DoomLoop();
+
+        convert = I_ProfileStart();
+        expand_pixels((unsigned int*)final_screen_buffer, screens[0], SCREENWIDTH * SCREENHEIGHT);
+        I_ProfileEnd(profile_convert, convert);
+        result->frames++;
+
+        if (demoplayback)
+            started = 1;
+        else if (started)
+            break;
+        else if (gameaction != ga_playdemo)
+            break; // a demo from another version
+    }
+    result->total = I_ProfileStart() - start;
+    result->tics = gametic - first_tic;
+    result->render = profile_time[profile_render];
+    result->ticker = profile_time[profile_ticker];
+    result->status_bar = profile_time[profile_statusbar];
+    result->hud = profile_time[profile_hud];
+    result->convert = profile_time[profile_convert];
+    profile_clock = 0;
+
+    // Back on the game clock from here
+    last_update_time = I_GetTime();
+    return started ? 0 : -1;
+}
+
+
 unsigned long doom_tick_midi()
 {
     return I_TickSong();
@@ -178,6 +178,7 @@ void D_Display(void)
     int y;
     doom_boolean wipe;
     doom_boolean redrawsbar;
+    unsigned long long start;
 
     if (nodrawers)
         return; // for comparative timing / profiling
@@ -216,7 +217,9 @@ void D_Display(void)
                 redrawsbar = true;
             if (inhelpscreensstate && !inhelpscreens)
                 redrawsbar = true;              // just put away the help screen
+            start = I_ProfileStart();
             ST_Drawer(viewheight == 200, redrawsbar);
+            I_ProfileEnd(profile_statusbar, start);
             fullscreen = viewheight == 200;
             break;
 
@@ -238,10 +241,19 @@ void D_Display(void)
 
     // draw the view directly
     if (gamestate == GS_LEVEL && !automapactive && gametic)
+    {
+        start = I_ProfileStart();
         R_RenderPlayerView(&players[displayplayer]);
+        I_ProfileEnd(profile_render, start);
+        V_MarkRect(viewwindowx, viewwindowy, scaledviewwidth, viewheight);
+    }
 
     if (gamestate == GS_LEVEL && gametic)
+    {
+        start = I_ProfileStart();
         HU_Drawer();
+        I_ProfileEnd(profile_hud, start);
+    }
 
     // clean up border stuff
     if (gamestate != oldgamestate && gamestate != GS_LEVEL)
@@ -32,6 +32,7 @@ extern doom_eof_fn doom_eof;
 extern doom_gettime_fn doom_gettime;
 extern doom_exit_fn doom_exit;
 extern doom_getenv_fn doom_getenv;
+extern doom_map_fn doom_map;
 
 
 const char* doom_itoa(int i, int radix);
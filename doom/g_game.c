@@ -612,6 +612,7 @@ void G_Ticker(void)
     int         i;
     int         buf;
     ticcmd_t*   cmd;
+    unsigned long long start;
 
     // do player reborns if needed
     for (i = 0; i < MAXPLAYERS; i++)
@@ -741,7 +742,9 @@ void G_Ticker(void)
     switch (gamestate)
     {
         case GS_LEVEL:
+            start = I_ProfileStart();
             P_Ticker();
+            I_ProfileEnd(profile_ticker, start);
             ST_Ticker();
             AM_Ticker();
             HU_Ticker();
@@ -81,6 +81,30 @@ int I_GetTime(void)
 }
 
 
+//
+// Profiling (doom_timedemo)
+//
+doom_gettime_fn profile_clock = 0;
+unsigned long long profile_time[NUMPROFILES];
+
+unsigned long long I_ProfileStart(void)
+{
+    int sec, usec;
+
+    if (!profile_clock)
+        return 0;
+    profile_clock(&sec, &usec);
+    return (unsigned long long)sec * 1000000 + usec;
+}
+
+
+void I_ProfileEnd(profile_t part, unsigned long long start)
+{
+    if (profile_clock)
+        profile_time[part] += I_ProfileStart() - start;
+}
+
+
 //
 // I_Init
 //
@@ -75,6 +75,25 @@ void I_Tactile(int on, int off, int total);
 
 void I_Error(char* error);
 
+// Time spent per subsystem while doom_timedemo() runs, in microseconds
+typedef enum
+{
+    profile_render,     // R_RenderPlayerView
+    profile_ticker,     // P_Ticker
+    profile_statusbar,  // ST_Drawer
+    profile_hud,        // HU_Drawer
+    profile_convert,    // frame to 32-bit pixels
+    NUMPROFILES
+} profile_t;
+
+extern doom_gettime_fn profile_clock;
+extern unsigned long long profile_time[NUMPROFILES];
+
+// Microseconds of profile_clock, 0 when no timedemo runs
+unsigned long long I_ProfileStart(void);
+// Adds the time since start to part
+void I_ProfileEnd(profile_t part, unsigned long long start);
+
 
 #endif
 
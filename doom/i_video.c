@@ -45,6 +45,10 @@ int doPointerWarp = POINTER_WARP_COUNTDOWN;
 
 unsigned char screen_palette[256 * 3];
 
+// screen_palette as ready 32-bit pixels, in the byte order of
+// doom_get_framebuffer(4): B, G, R, 255. Rebuilt by I_SetPalette.
+unsigned int screen_palette_rgba[256];
+
 doom_boolean mousemoved = false;
 doom_boolean shmFinished;
 
@@ -114,7 +118,7 @@ void I_FinishUpdate(void)
             screens[0][(SCREENHEIGHT - 1) * SCREENWIDTH + i] = 0xff;
         for (; i < 20 * 2; i += 2)
             screens[0][(SCREENHEIGHT - 1) * SCREENWIDTH + i] = 0x0;
-
+        V_MarkRect(0, SCREENHEIGHT - 1, 20 * 2, 1);
     }
 }
 
@@ -133,7 +137,20 @@ void I_ReadScreen(byte* scr)
 //
 void I_SetPalette(byte* palette)
 {
+    int i;
+
     doom_memcpy(screen_palette, palette, 256 * 3);
+    for (i = 0; i < 256; ++i)
+    {
+        byte* entry = (byte*)&screen_palette_rgba[i];
+        entry[0] = palette[i * 3 + 2];
+        entry[1] = palette[i * 3 + 1];
+        entry[2] = palette[i * 3 + 0];
+        entry[3] = 255;
+    }
+
+    // Same pixels, new colors
+    V_MarkRect(0, 0, SCREENWIDTH, SCREENHEIGHT);
 }
 
 
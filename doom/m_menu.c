@@ -2115,6 +2115,7 @@ void M_Drawer(void)
             color = colormaps[color + (20 * 256)];
             screens[0][j] = color;
         }
+        V_MarkRect(0, 0, SCREENWIDTH, SCREENHEIGHT);
     }
 
     if (currentMenu->routine)
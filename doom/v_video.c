@@ -38,6 +38,7 @@
 byte* screens[5];
 
 int dirtybox[4];
+byte dirtyrows[SCREENHEIGHT];
 
 // Now where did these came from?
 byte gammatable[5][256] =
@@ -134,6 +135,16 @@ void V_MarkRect(int x, int y, int width, int height)
 {
     M_AddToBox(dirtybox, x, y);
     M_AddToBox(dirtybox, x + width - 1, y + height - 1);
+
+    if (y < 0)
+    {
+        height += y;
+        y = 0;
+    }
+    if (y + height > SCREENHEIGHT)
+        height = SCREENHEIGHT - y;
+    if (height > 0)
+        doom_memset(dirtyrows + y, 1, height);
 }
 
 
@@ -39,6 +39,7 @@
 // Screen 1 is an extra buffer.
 extern byte* screens[5];
 extern int dirtybox[4];
+extern byte dirtyrows[SCREENHEIGHT]; // rows of screens[0] changed since the last blit
 extern byte gammatable[5][256];
 extern int usegamma;
 
@@ -120,6 +120,8 @@ void W_AddFile(char* filename)
     filelump_t singleinfo;
     void* storehandle;
     void* allocated = 0;
+    byte* mapped = 0;
+    int mapsize = 0;
 
     // open the file and add to directory
 
@@ -201,12 +203,27 @@ void W_AddFile(char* filename)
 
     storehandle = reloadname ? 0 : handle;
 
+    // A file the host has in memory is used in place. Not on big-endian
+    // machines: there Doom byte-swaps some lumps where they lie.
+#ifndef __BIG_ENDIAN__
+    if (doom_map && storehandle)
+        mapped = doom_map(handle, &mapsize);
+    if (mapped)
+        Z_AddMapped(mapped, mapsize);
+#endif
+
     for (i = startlump; i < (unsigned)numlumps; i++, lump_p++, fileinfo++)
     {
         lump_p->handle = storehandle;
         lump_p->position = LONG(fileinfo->filepos);
         lump_p->size = LONG(fileinfo->size);
+        lump_p->data = 0;
         doom_strncpy(lump_p->name, fileinfo->name, 8);
+
+        if (mapped && lump_p->position >= 0 && lump_p->size >= 0
+            && lump_p->position <= mapsize
+            && lump_p->size <= mapsize - lump_p->position)
+            lump_p->data = mapped + lump_p->position;
     }
 
     if (reloadname)
@@ -451,6 +468,12 @@ void W_ReadLump(int lump, void* dest)
 
     l = lumpinfo + lump;
 
+    if (l->data)
+    {
+        doom_memcpy(dest, l->data, l->size);
+        return;
+    }
+
     // ??? I_BeginRead ();
 
     if (l->handle == 0)
@@ -506,6 +529,10 @@ void* W_CacheLumpNum(int lump, int tag)
         I_Error(error_buf);
     }
 
+    // in place in a mapped file: nothing to read, nothing to purge
+    if (lumpinfo[lump].data)
+        return lumpinfo[lump].data;
+
     if (!lumpcache[lump])
     {
         // read the lump in
@@ -52,6 +52,7 @@ typedef struct
     void* handle;
     int position;
     int size;
+    void* data; // the lump in place in a mapped file, 0 if it is read
 } lumpinfo_t;
 
 
@@ -43,6 +43,7 @@
 
 #define ZONEID 0x1d4a11
 #define MINFRAGMENT 64
+#define MAXMAPPED 20 // MAXWADFILES
 
 
 typedef struct
@@ -59,6 +60,13 @@ typedef struct
 
 memzone_t* mainzone;
 
+// Files the host has in memory, whose lumps are used in place
+// (W_CacheLumpNum). They are not zone blocks: freeing them or
+// changing their tag does nothing.
+byte* mapped_start[MAXMAPPED];
+byte* mapped_end[MAXMAPPED];
+int nummapped;
+
 
 //
 // Z_ClearZone
@@ -114,6 +122,35 @@ void Z_Init(void)
 }
 
 
+//
+// Z_AddMapped
+//
+void Z_AddMapped(void* ptr, int size)
+{
+    if (nummapped == MAXMAPPED)
+        I_Error("Error: Z_AddMapped: too many mapped files");
+
+    mapped_start[nummapped] = (byte*)ptr;
+    mapped_end[nummapped] = (byte*)ptr + size;
+    nummapped++;
+}
+
+
+//
+// Z_IsMapped
+//
+int Z_IsMapped(void* ptr)
+{
+    int i;
+
+    for (i = 0; i < nummapped; i++)
+        if ((byte*)ptr >= mapped_start[i] && (byte*)ptr < mapped_end[i])
+            return 1;
+
+    return 0;
+}
+
+
 //
 // Z_Free
 //
@@ -122,6 +159,9 @@ void Z_Free(void* ptr)
     memblock_t* block;
     memblock_t* other;
 
+    if (Z_IsMapped(ptr))
+        return;
+
     block = (memblock_t*)((byte*)ptr - sizeof(memblock_t));
 
     if (block->id != ZONEID)
@@ -447,6 +487,9 @@ void Z_ChangeTag2(void* ptr, int tag)
 {
     memblock_t* block;
 
+    if (Z_IsMapped(ptr))
+        return;
+
     block = (memblock_t*)((byte*)ptr - sizeof(memblock_t));
 
     if (block->id != ZONEID)
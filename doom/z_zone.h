@@ -52,6 +52,8 @@ void  Z_FileDumpHeap(void* f);
 void  Z_CheckHeap(void);
 void  Z_ChangeTag2(void* ptr, int tag);
 int   Z_FreeMemory(void);
+void  Z_AddMapped(void* ptr, int size);
+int   Z_IsMapped(void* ptr);
 
 
 typedef struct memblock_s
@@ -70,7 +72,8 @@ typedef struct memblock_s
 //
 #define Z_ChangeTag(p,t) \
 { \
-    if (( (memblock_t *)( (byte *)(p) - sizeof(memblock_t)))->id!=0x1d4a11) \
+    if (!Z_IsMapped(p) && \
+        ( (memblock_t *)( (byte *)(p) - sizeof(memblock_t)))->id!=0x1d4a11) \
     { \
         /*I_Error("Error: Z_CT at "__FILE__":%i",__LINE__);*/ \
         char buf[260]; \
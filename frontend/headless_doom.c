@@ -0,0 +1,260 @@
+// Doom without a display, for benchmarks and CI.
+//
+// headless_doom [-tics n] [-demo lump] [-hash] [-pertic] [-ppm k dir] [wad] [-- doom args]
+// headless_doom -timedemo lump [wad] [-- doom args]
+//
+// Doom's clock is driven by the tic count, not by the wall clock: every
+// iteration is exactly one tic, however long it takes, so a run does the
+// same work natively and under a BF interpreter. Frames are discarded
+// unless -hash or -ppm asks for them.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <crt/doom_env.h>
+
+#define HEADLESS_TICRATE 35
+#define HEADLESS_FNV_BASIS 14695981039346656037ULL
+#define HEADLESS_FNV_PRIME 1099511628211ULL
+
+struct DoomControlRegs g_HeadlessDoomControlRegs;
+void *g_DoomHeapAddress = NULL;
+unsigned int g_DoomHeapSize = 0;
+char *g_DoomWadAddress = NULL;
+unsigned int g_DoomWadSize = 0;
+struct DoomControlRegs *g_DoomControlRegs = &g_HeadlessDoomControlRegs;
+
+static int g_HeadlessTics = 0;
+static long long g_HeadlessBusyNs = 0;
+static long long g_HeadlessMinNs = 0;
+static long long g_HeadlessMaxNs = 0;
+static int g_HeadlessHashing = 0;
+static unsigned long long g_HeadlessHash = HEADLESS_FNV_BASIS;
+
+void EnvPutChar(int c) {
+    putchar(c);
+}
+
+static long long HeadlessNowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/* Real time for -timedemo, which does not look at the registers */
+static void HeadlessClock(int *sec, int *usec) {
+    long long ns = HeadlessNowNs();
+    *sec  = (int)(ns / 1000000000LL);
+    *usec = (int)(ns % 1000000000LL / 1000);
+}
+
+/* Time of the given tic, rounded up so that I_GetTime returns the tic.
+ * It starts at 1 s: I_GetTime takes the first nonzero second as base. */
+static void HeadlessSetTime(int tic) {
+    long long usec = 1000000LL + ((long long)tic * 1000000LL + HEADLESS_TICRATE - 1) / HEADLESS_TICRATE;
+    g_HeadlessDoomControlRegs.time_sec  = (int)(usec / 1000000LL);
+    g_HeadlessDoomControlRegs.time_usec = (int)(usec % 1000000LL);
+}
+
+static void HeadlessReport(void) {
+    printf("HEADLESS: %d tics in %.3f s, per tic avg %.3f ms, min %.3f ms, max %.3f ms\n",
+           g_HeadlessTics, g_HeadlessBusyNs / 1e9,
+           g_HeadlessTics ? g_HeadlessBusyNs / 1e6 / g_HeadlessTics : 0.0,
+           g_HeadlessMinNs / 1e6, g_HeadlessMaxNs / 1e6);
+    if (g_HeadlessHashing) {
+        printf("HEADLESS: frame hash %016llx\n", g_HeadlessHash);
+    }
+    fflush(stdout);
+}
+
+/* The end of a -demo run comes through here (I_Quit) */
+void EnvExit(int code) {
+    HeadlessReport();
+    exit(code);
+}
+
+static unsigned long long HeadlessHashBytes(unsigned long long hash, const unsigned char *data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * HEADLESS_FNV_PRIME;
+    }
+    return hash;
+}
+
+/* The indexed frame through the palette (B, G, R, 255 per entry) as a PPM */
+static int HeadlessWritePpm(const char *dir, int tic) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/frame%06d.ppm", dir, tic);
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        fprintf(stderr, "Error: cannot create %s\n", path);
+        return -1;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", CRT_DOOM_FRAME_WIDTH, CRT_DOOM_FRAME_HEIGHT);
+    for (int i = 0; i < CRT_DOOM_FRAME_WIDTH * CRT_DOOM_FRAME_HEIGHT; i++) {
+        const unsigned char *color = (const unsigned char *)&g_HeadlessDoomControlRegs.palette[g_HeadlessDoomControlRegs.indexed[i]];
+        unsigned char rgb[3] = { color[2], color[1], color[0] };
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+    return 0;
+}
+
+/* Mapped like in lnx_doom.c: a run only pages in the lumps it uses */
+static int Headless_LoadFile(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error: cannot open file %s\n", path);
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0 || st.st_size > 0x7fffffff) {
+        close(fd);
+        fprintf(stderr, "Error: empty/invalid file size\n");
+        return -1;
+    }
+
+    void *buf = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (buf == MAP_FAILED) {
+        fprintf(stderr, "Error: mmap failed\n");
+        return -1;
+    }
+
+    g_DoomWadAddress = (char*)buf;
+    g_DoomWadSize    = (unsigned int)st.st_size;
+    return 0;
+}
+
+static void HeadlessUsage(const char *name) {
+    fprintf(stderr,
+            "usage: %s [-tics n] [-demo lump] [-hash] [-pertic] [-ppm k dir] [wad] [-- doom args]\n"
+            "       %s -timedemo lump [wad] [-- doom args]\n"
+            "  -tics n     stop after n tics (default 350, no limit with -demo)\n"
+            "  -demo lump  play the demo lump and stop at its end\n"
+            "  -hash       hash every frame with its palette, print the run's hash\n"
+            "  -pertic     print the time (and hash) of every tic\n"
+            "  -ppm k dir  write every k-th frame to dir as a PPM\n"
+            "  -timedemo lump  play the demo lump as fast as possible, print FPS\n"
+            "                  and the time per subsystem\n",
+            name, name);
+}
+
+int main(int argc, char *argv[]) {
+    const char *wad_path = "doom.wad";
+    const char *demo = NULL;
+    const char *timedemo = NULL;
+    const char *ppm_dir = NULL;
+    int ppm_every = 0;
+    int tics = -1;
+    int per_tic = 0;
+    char *doom_args[8];
+    int doom_argc = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-tics") && i + 1 < argc) {
+            tics = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-demo") && i + 1 < argc) {
+            demo = argv[++i];
+        } else if (!strcmp(argv[i], "-timedemo") && i + 1 < argc) {
+            timedemo = argv[++i];
+        } else if (!strcmp(argv[i], "-hash")) {
+            g_HeadlessHashing = 1;
+        } else if (!strcmp(argv[i], "-pertic")) {
+            per_tic = 1;
+        } else if (!strcmp(argv[i], "-ppm") && i + 2 < argc) {
+            ppm_every = atoi(argv[++i]);
+            ppm_dir = argv[++i];
+        } else if (!strcmp(argv[i], "--")) {
+            while (++i < argc && doom_argc < 6) {
+                doom_args[doom_argc++] = argv[i];
+            }
+        } else if (argv[i][0] != '-') {
+            wad_path = argv[i];
+        } else {
+            HeadlessUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (tics < 0) {
+        tics = demo ? 0 : 10 * HEADLESS_TICRATE;
+    }
+    if (demo) {
+        doom_args[doom_argc++] = "-playdemo";
+        doom_args[doom_argc++] = (char*)demo;
+    }
+
+    g_DoomHeapSize    = 0x4000000;
+    g_DoomHeapAddress = malloc(g_DoomHeapSize);
+    if (!g_DoomHeapAddress) {
+        fprintf(stderr, "Error: cannot allocate Doom heap\n");
+        return 1;
+    }
+    if (Headless_LoadFile(wad_path) != 0) {
+        fprintf(stderr, "Failed to load WAD\n");
+        return 1;
+    }
+
+    /* Without a hash or pictures the frame is not even expanded */
+    if (g_HeadlessHashing || ppm_every > 0) {
+        g_HeadlessDoomControlRegs.format = CRT_DOOM_PIXELS_INDEXED;
+    } else {
+        g_HeadlessDoomControlRegs.format = CRT_DOOM_PIXELS_RGBA;
+        g_HeadlessDoomControlRegs.pixels = NULL;
+    }
+
+    HeadlessSetTime(0);
+    CrtDoomInitArgs(doom_argc, doom_args);
+
+    if (timedemo) {
+        int ret = CrtDoomTimedemo(timedemo, HeadlessClock);
+        fflush(stdout);
+        return ret ? 1 : 0;
+    }
+
+    while (!tics || g_HeadlessTics < tics) {
+        HeadlessSetTime(g_HeadlessTics + 1);
+
+        long long start = HeadlessNowNs();
+        CrtDoomIteration();
+        long long busy = HeadlessNowNs() - start;
+
+        g_HeadlessTics++;
+        g_HeadlessBusyNs += busy;
+        if (g_HeadlessTics == 1 || busy < g_HeadlessMinNs) {
+            g_HeadlessMinNs = busy;
+        }
+        if (busy > g_HeadlessMaxNs) {
+            g_HeadlessMaxNs = busy;
+        }
+
+        unsigned long long frame_hash = 0;
+        if (g_HeadlessHashing) {
+            frame_hash = HeadlessHashBytes(HEADLESS_FNV_BASIS, g_HeadlessDoomControlRegs.indexed,
+                                           CRT_DOOM_FRAME_WIDTH * CRT_DOOM_FRAME_HEIGHT);
+            frame_hash = HeadlessHashBytes(frame_hash, (const unsigned char *)g_HeadlessDoomControlRegs.palette,
+                                           256 * sizeof(g_HeadlessDoomControlRegs.palette[0]));
+            g_HeadlessHash = HeadlessHashBytes(g_HeadlessHash, (const unsigned char *)&frame_hash, sizeof(frame_hash));
+        }
+        if (per_tic) {
+            if (g_HeadlessHashing) {
+                printf("TIC %d %.3f ms %016llx\n", g_HeadlessTics, busy / 1e6, frame_hash);
+            } else {
+                printf("TIC %d %.3f ms\n", g_HeadlessTics, busy / 1e6);
+            }
+        }
+        if (ppm_every > 0 && g_HeadlessTics % ppm_every == 0) {
+            if (HeadlessWritePpm(ppm_dir, g_HeadlessTics) != 0) {
+                return 1;
+            }
+        }
+    }
+
+    HeadlessReport();
+    return 0;
+}
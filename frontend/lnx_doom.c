@@ -1,12 +1,20 @@
-// gcc -O2 -Wall -Wextra -o linux_doom linux_doom.c -lX11
-// sudo apt-get install libx11-dev
+// gcc -O2 -Wall -Wextra -o linux_doom linux_doom.c -lX11 -lXext
+// sudo apt-get install libx11-dev libxext-dev
 
 #include <X11/Xlib.h>
+#include <X11/Xutil.h>
 #include <X11/keysym.h>
+#include <X11/extensions/XShm.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <errno.h>
 #include <unistd.h>
 
 #include <crt/doom_env.h>  
@@ -23,6 +31,10 @@ void EnvPutChar(int c) {
     fflush(stdout);
 }
 
+void EnvExit(int code) {
+    exit(code);
+}
+
 static void LinuxDoomUpdateTime(void) {
     struct timespec ts;
     clock_gettime(CLOCK_MONOTONIC, &ts);
@@ -30,6 +42,22 @@ static void LinuxDoomUpdateTime(void) {
     g_LinuxDoomControlRegs.time_usec = (int)(ts.tv_nsec / 1000);
 }
 
+static long long LinuxNowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/* Sleeps until an absolute point on the monotonic clock, so the time the
+ * frame took comes off the sleep instead of adding to it. */
+static void LinuxSleepUntil(long long deadline_ns) {
+    struct timespec ts;
+    ts.tv_sec  = (time_t)(deadline_ns / 1000000000LL);
+    ts.tv_nsec = (long)(deadline_ns % 1000000000LL);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+    }
+}
+
 static void MiniDoomKeyAction(int key, int action) {
     int k = 0;
     switch (key) {
@@ -60,41 +88,119 @@ static void MiniDoomKeyAction(int key, int action) {
 static void MiniDoomKeyDown(int key) { MiniDoomKeyAction(key, 1); }
 static void MiniDoomKeyUp  (int key) { MiniDoomKeyAction(key, 2); }
 
+/* The WAD is mapped, not read: its pages come in as Doom touches the
+ * lumps, which it uses in place (MiniDoomMap). The mapping is private,
+ * so the few lumps Doom writes to get pages of their own and the file is
+ * never changed. DOOM_WAD_CHECKSUM=1 prints the byte sum of the file,
+ * which reads all of it. */
 static int Linux_LoadFile(const char *path) {
-    FILE *f = fopen(path, "rb");
-    if (!f) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
         fprintf(stderr, "Error: cannot open file %s\n", path);
         return -1;
     }
-    if (fseek(f, 0, SEEK_END) != 0) { fclose(f); return -1; }
-    long sz = ftell(f);
-    if (sz <= 0) { fclose(f); fprintf(stderr, "Error: empty/invalid file size\n"); return -1; }
-    rewind(f);
-
-    void *buf = malloc((size_t)sz);
-    if (!buf) { fclose(f); fprintf(stderr, "Error: malloc failed\n"); return -1; }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0 || st.st_size > 0x7fffffff) {
+        close(fd);
+        fprintf(stderr, "Error: empty/invalid file size\n");
+        return -1;
+    }
 
-    size_t rd = fread(buf, 1, (size_t)sz, f);
-    fclose(f);
-    if (rd != (size_t)sz) {
-        fprintf(stderr, "Error: fread mismatch (%zu/%ld)\n", rd, sz);
-        free(buf);
+    void *buf = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (buf == MAP_FAILED) {
+        fprintf(stderr, "Error: mmap failed\n");
         return -1;
     }
 
     g_DoomWadAddress = (char*)buf;
-    g_DoomWadSize    = (unsigned int)sz;
+    g_DoomWadSize    = (unsigned int)st.st_size;
 
-    unsigned long long summ = 0;
-    for (unsigned i = 0; i < g_DoomWadSize; i++) {
-        summ += 1 + (unsigned char)g_DoomWadAddress[i];
+    if (getenv("DOOM_WAD_CHECKSUM")) {
+        unsigned long long summ = 0;
+        for (unsigned i = 0; i < g_DoomWadSize; i++) {
+            summ += 1 + (unsigned char)g_DoomWadAddress[i];
+        }
+        printf("Successfully loaded file: %s (%u bytes) %llu code\n", path, g_DoomWadSize, summ);
+    } else {
+        printf("Successfully loaded file: %s (%u bytes)\n", path, g_DoomWadSize);
     }
-    printf("Successfully loaded file: %s (%u bytes) %llu code\n", path, g_DoomWadSize, summ);
     return 0;
 }
 
+static void Linux_UnloadFile(void) {
+    munmap(g_DoomWadAddress, g_DoomWadSize);
+    g_DoomWadAddress = NULL;
+    g_DoomWadSize    = 0;
+}
+
+static int  g_DoomWinScale  = 2;
 static int  g_DoomWinWidth  = 640;
-static int  g_DoomWinHeight = 480;
+static int  g_DoomWinHeight = 400;
+
+/* With MIT-SHM the server reads the frame out of a shared memory segment
+ * instead of receiving it over the socket. Only a local display can do
+ * that; anywhere else the image is a plain XImage sent with XPutImage. */
+static XShmSegmentInfo g_LinuxShm;
+static int g_LinuxShmFailed = 0;
+
+static int LinuxShmErrorHandler(Display *dpy, XErrorEvent *ev) {
+    (void)dpy;
+    (void)ev;
+    g_LinuxShmFailed = 1;
+    return 0;
+}
+
+static XImage *LinuxCreateShmImage(Display *dpy, int screen, int width, int height) {
+    if (getenv("DOOM_NO_SHM") || !XShmQueryExtension(dpy)) {
+        return NULL;
+    }
+    XImage *img = XShmCreateImage(dpy, DefaultVisual(dpy, screen), DefaultDepth(dpy, screen),
+                                  ZPixmap, NULL, &g_LinuxShm, width, height);
+    if (!img) {
+        return NULL;
+    }
+    if (img->bits_per_pixel != 32) {
+        XDestroyImage(img);
+        return NULL;
+    }
+    g_LinuxShm.shmid = shmget(IPC_PRIVATE, (size_t)img->bytes_per_line * (size_t)img->height, IPC_CREAT | 0600);
+    if (g_LinuxShm.shmid < 0) {
+        XDestroyImage(img);
+        return NULL;
+    }
+    g_LinuxShm.shmaddr = img->data = (char*)shmat(g_LinuxShm.shmid, NULL, 0);
+    g_LinuxShm.readOnly = False;
+
+    /* a refused attach only shows up as an asynchronous X error */
+    g_LinuxShmFailed = img->data == (char*)-1;
+    if (!g_LinuxShmFailed) {
+        XErrorHandler old_handler = XSetErrorHandler(LinuxShmErrorHandler);
+        XShmAttach(dpy, &g_LinuxShm);
+        XSync(dpy, False);
+        XSetErrorHandler(old_handler);
+    }
+    /* the segment goes away once both sides have detached */
+    shmctl(g_LinuxShm.shmid, IPC_RMID, NULL);
+    if (g_LinuxShmFailed) {
+        if (img->data != (char*)-1) {
+            shmdt(img->data);
+        }
+        img->data = NULL;
+        XDestroyImage(img);
+        return NULL;
+    }
+    return img;
+}
+
+static void LinuxDestroyImage(Display *dpy, XImage *img, int shm) {
+    if (shm) {
+        XShmDetach(dpy, &g_LinuxShm);
+        shmdt(g_LinuxShm.shmaddr);
+        img->data = NULL;
+    }
+    XDestroyImage(img);
+}
 
 int main(int argc, char *argv[]) {
     const char *wad_path = (argc > 1) ? argv[1] : "doom.wad";
@@ -108,6 +214,14 @@ int main(int argc, char *argv[]) {
     int screen = DefaultScreen(dpy);
     Window root = RootWindow(dpy, screen);
 
+    /* DOOM_SCALE=n: every Doom pixel is n x n window pixels */
+    const char *scale_env = getenv("DOOM_SCALE");
+    if (scale_env && atoi(scale_env) >= 1 && atoi(scale_env) <= 8) {
+        g_DoomWinScale = atoi(scale_env);
+    }
+    g_DoomWinWidth  = CRT_DOOM_FRAME_WIDTH * g_DoomWinScale;
+    g_DoomWinHeight = CRT_DOOM_FRAME_HEIGHT * g_DoomWinScale;
+
     XSetWindowAttributes attrs;
     attrs.event_mask = ExposureMask | KeyPressMask | KeyReleaseMask | StructureNotifyMask;
     Window win = XCreateWindow(
@@ -122,38 +236,55 @@ int main(int argc, char *argv[]) {
     XStoreName(dpy, win, "Doom window (Linux/X11)");
     XMapWindow(dpy, win);
 
-    int bytes_per_pixel = 4;
-    size_t img_size = (size_t)g_DoomWinWidth * (size_t)g_DoomWinHeight * (size_t)bytes_per_pixel;
-    char *pixels = (char*)calloc(1, img_size);
-    if (!pixels) {
-        fprintf(stderr, "Error: cannot allocate framebuffer\n");
-        return 1;
-    }
+    char *pixels;
+    XImage *img = LinuxCreateShmImage(dpy, screen, g_DoomWinWidth, g_DoomWinHeight);
+    int shm = img != NULL;
+    if (shm) {
+        pixels = img->data;
+    } else {
+        int bytes_per_pixel = 4;
+        size_t img_size = (size_t)g_DoomWinWidth * (size_t)g_DoomWinHeight * (size_t)bytes_per_pixel;
+        pixels = (char*)calloc(1, img_size);
+        if (!pixels) {
+            fprintf(stderr, "Error: cannot allocate framebuffer\n");
+            return 1;
+        }
 
-    XImage *img = XCreateImage(
-        dpy, DefaultVisual(dpy, screen),
-        24,               
-        ZPixmap,
-        0,                
-        pixels,           
-        g_DoomWinWidth,
-        g_DoomWinHeight,
-        32,               // bitmap_pad
-        g_DoomWinWidth * bytes_per_pixel // bytes_per_line
-    );
-    if (!img) {
-        fprintf(stderr, "Error: XCreateImage failed\n");
-        free(pixels);
-        return 1;
+        img = XCreateImage(
+            dpy, DefaultVisual(dpy, screen),
+            24,               
+            ZPixmap,
+            0,                
+            pixels,           
+            g_DoomWinWidth,
+            g_DoomWinHeight,
+            32,               // bitmap_pad
+            g_DoomWinWidth * bytes_per_pixel // bytes_per_line
+        );
+        if (!img) {
+            fprintf(stderr, "Error: XCreateImage failed\n");
+            free(pixels);
+            return 1;
+        }
     }
+    printf("Framebuffer %dx%d (%dx), %s\n", g_DoomWinWidth, g_DoomWinHeight, g_DoomWinScale,
+           shm ? "MIT-SHM" : "XPutImage");
 
     GC gc = XCreateGC(dpy, win, 0, NULL);
 
+    /* Doom renders every frame straight into the XImage's pixels */
+    g_LinuxDoomControlRegs.pixels = pixels;
+    g_LinuxDoomControlRegs.width  = g_DoomWinWidth;
+    g_LinuxDoomControlRegs.height = g_DoomWinHeight;
+    g_LinuxDoomControlRegs.pitch  = img->bytes_per_line / 4;
+    g_LinuxDoomControlRegs.format = CRT_DOOM_PIXELS_RGBA;
+    g_LinuxDoomControlRegs.scale  = g_DoomWinScale;
+
     g_DoomHeapSize    = 0x4000000;
     g_DoomHeapAddress = malloc(g_DoomHeapSize);
     if (!g_DoomHeapAddress) {
         fprintf(stderr, "Error: cannot allocate Doom heap\n");
-        XDestroyImage(img); 
+        LinuxDestroyImage(dpy, img, shm);
         XFreeGC(dpy, gc);
         XDestroyWindow(dpy, win);
         XCloseDisplay(dpy);
@@ -163,7 +294,7 @@ int main(int argc, char *argv[]) {
     if (Linux_LoadFile(wad_path) != 0) {
         fprintf(stderr, "Failed to load WAD\n");
         free(g_DoomHeapAddress);
-        XDestroyImage(img);
+        LinuxDestroyImage(dpy, img, shm);
         XFreeGC(dpy, gc);
         XDestroyWindow(dpy, win);
         XCloseDisplay(dpy);
@@ -173,13 +304,55 @@ int main(int argc, char *argv[]) {
     CrtDoomInit();
     printf("INITED!!\n");
 
+    /* DOOM_HEAP_REPORT=1: heap usage after startup and at exit. */
+    int heap_report = getenv("DOOM_HEAP_REPORT") != NULL;
+    if (heap_report) {
+        CrtDoomHeapReport();
+    }
+
+    /*
+     * Frames start on a grid of deadlines one period apart (DOOM_FPS,
+     * default 35, Doom's tic rate). A frame that ends past its deadline
+     * starts the next one at once and the grid moves up with it: nothing
+     * is slept when Doom is slower than the period, and nothing is made
+     * up either. With DOOM_FRAMESKIP set, a late frame is not sent to the
+     * server (at most 3 in a row); its rows go out with the next one.
+     * DOOM_FRAME_STATS prints the time frames take against the period
+     * once a second.
+     */
+    int fps = 35;
+    const char *fps_env = getenv("DOOM_FPS");
+    if (fps_env && atoi(fps_env) >= 1 && atoi(fps_env) <= 1000) {
+        fps = atoi(fps_env);
+    }
+    long long period = 1000000000LL / fps;
+    int frame_skip = getenv("DOOM_FRAMESKIP") != NULL;
+    int frame_stats = getenv("DOOM_FRAME_STATS") != NULL;
+    int skipped_in_row = 0;
+    int stats_frames = 0, stats_skipped = 0;
+    long long stats_busy = 0, stats_worst = 0, stats_start = LinuxNowNs();
+    long long deadline = stats_start;
+    unsigned char send_rows[CRT_DOOM_FRAME_HEIGHT];
+    memset(send_rows, 0, sizeof(send_rows));
+
+    int shm_completion = shm ? XShmGetEventBase(dpy) + ShmCompletion : -1;
+    int shm_pending = 0;
+    int expose = 0;
     int running = 1;
     while (running) {
-        while (XPending(dpy)) {
+        long long frame_start = LinuxNowNs();
+
+        /* Doom must not draw into the segment while the server reads it */
+        while (shm_pending || XPending(dpy)) {
             XEvent ev;
             XNextEvent(dpy, &ev);
+            if (ev.type == shm_completion) {
+                shm_pending--;
+                continue;
+            }
             switch (ev.type) {
                 case Expose:
+                    expose = 1;
                     break;
                 case ConfigureNotify:
                     break;
@@ -199,20 +372,78 @@ int main(int argc, char *argv[]) {
         }
 
         LinuxDoomUpdateTime();
-        g_LinuxDoomControlRegs.pixels = pixels;
-        g_LinuxDoomControlRegs.width  = g_DoomWinWidth;
-        g_LinuxDoomControlRegs.height = g_DoomWinHeight;
-
         CrtDoomIteration();
 
-        XPutImage(dpy, win, gc, img, 0, 0, 0, 0, g_DoomWinWidth, g_DoomWinHeight);
-        XFlush(dpy);
+        for (int y = 0; y < CRT_DOOM_FRAME_HEIGHT; y++) {
+            send_rows[y] |= expose | g_LinuxDoomControlRegs.rows[y];
+        }
+        expose = 0;
+
+        deadline += period;
+        int late = LinuxNowNs() > deadline;
+        if (frame_skip && late && skipped_in_row < 3) {
+            skipped_in_row++;
+            stats_skipped++;
+        } else {
+            skipped_in_row = 0;
+        }
 
-        usleep(10000);
+        /* send the runs of rows Doom redrew since the last frame sent */
+        int sent = 0;
+        for (int y = 0; !skipped_in_row && y < CRT_DOOM_FRAME_HEIGHT; ) {
+            if (!send_rows[y]) {
+                y++;
+                continue;
+            }
+            int top = y;
+            while (y < CRT_DOOM_FRAME_HEIGHT && send_rows[y]) {
+                send_rows[y++] = 0;
+            }
+            int win_y = top * g_DoomWinScale;
+            int win_h = (y - top) * g_DoomWinScale;
+            if (shm) {
+                XShmPutImage(dpy, win, gc, img, 0, win_y, 0, win_y, g_DoomWinWidth, win_h, True);
+                shm_pending++;
+            } else {
+                XPutImage(dpy, win, gc, img, 0, win_y, 0, win_y, g_DoomWinWidth, win_h);
+            }
+            sent = 1;
+        }
+        if (sent) {
+            XFlush(dpy);
+        }
+
+        long long frame_end = LinuxNowNs();
+        long long busy = frame_end - frame_start;
+        stats_frames++;
+        stats_busy += busy;
+        if (busy > stats_worst) {
+            stats_worst = busy;
+        }
+        if (frame_stats && frame_end - stats_start >= 1000000000LL) {
+            printf("FRAME: %d frames, %d not sent, avg %.2f ms, max %.2f ms of %.2f ms (%d%% busy)\n",
+                   stats_frames, stats_skipped,
+                   stats_busy / 1e6 / stats_frames, stats_worst / 1e6, period / 1e6,
+                   (int)(stats_busy * 100 / (frame_end - stats_start)));
+            fflush(stdout);
+            stats_frames = stats_skipped = 0;
+            stats_busy = stats_worst = 0;
+            stats_start = frame_end;
+        }
+
+        if (frame_end < deadline) {
+            LinuxSleepUntil(deadline);
+        } else {
+            deadline = frame_end;
+        }
     }
 
+    if (heap_report) {
+        CrtDoomHeapReport();
+    }
     free(g_DoomHeapAddress);
-    XDestroyImage(img);
+    Linux_UnloadFile();
+    LinuxDestroyImage(dpy, img, shm);
     XFreeGC(dpy, gc);
     XDestroyWindow(dpy, win);
     XCloseDisplay(dpy);
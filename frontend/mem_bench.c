@@ -0,0 +1,234 @@
+// The block routines of the crt (crtdoom_memcpy/memset/memcmp) and of
+// PureDOOM (doom_memcpy/memset), natively.
+//
+// mem_bench [-check]
+//
+// Every routine is first checked against a byte loop for all source and
+// destination offsets within a vector and lengths up to a few vectors, so
+// the aligned head, the word and vector bodies and the tails shorter than
+// a word or a vector all run. The timings follow unless -check is given;
+// the exit code is the number of failed checks. Time a Release build
+// (CMAKE_BUILD_TYPE), the default one is not optimized.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <crt/doom_env.h>
+
+// doom_crt.h maps the libc names onto these, so it is not included here
+void *crtdoom_memset(void *addr, int val, int len);
+void *crtdoom_memcpy(void *dest, const void *src, int len);
+int crtdoom_memcmp(const void *p1, const void *p2, int len);
+void doom_memset(void *ptr, int value, int num);
+void *doom_memcpy(void *destination, const void *source, int num);
+
+#define BENCH_VECTOR 16
+#define BENCH_CHECK_LEN (4 * BENCH_VECTOR + 7)
+#define BENCH_BUF_SIZE (64000 + 2 * BENCH_VECTOR)
+#define BENCH_MIN_NS 20000000LL
+
+struct DoomControlRegs g_BenchDoomControlRegs;
+void *g_DoomHeapAddress = NULL;
+unsigned int g_DoomHeapSize = 0;
+char *g_DoomWadAddress = NULL;
+unsigned int g_DoomWadSize = 0;
+struct DoomControlRegs *g_DoomControlRegs = &g_BenchDoomControlRegs;
+
+static unsigned char g_BenchSrc[BENCH_BUF_SIZE];
+static unsigned char g_BenchDst[BENCH_BUF_SIZE];
+static unsigned char g_BenchRef[BENCH_BUF_SIZE];
+static unsigned int g_BenchRandom = 12345;
+static int g_BenchFailures = 0;
+
+void EnvPutChar(int c) {
+    putchar(c);
+}
+
+void EnvExit(int code) {
+    exit(code);
+}
+
+static unsigned char BenchRandomByte(void) {
+    g_BenchRandom = g_BenchRandom * 1103515245u + 12345u;
+    return (unsigned char)(g_BenchRandom >> 16);
+}
+
+static void BenchFillRandom(unsigned char *p, int len) {
+    while (len-- > 0) {
+        *p++ = BenchRandomByte();
+    }
+}
+
+static long long BenchNowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void BenchFail(const char *name, int dst_off, int src_off, int len) {
+    printf("FAILED %s dst+%d src+%d len %d\n", name, dst_off, src_off, len);
+    g_BenchFailures++;
+}
+
+/* The crt's memcmp before it skipped words: the reference result */
+static int BenchByteMemcmp(const void *p1, const void *p2, int len) {
+    const char *q1 = p1;
+    const char *q2 = p2;
+    int r = 0;
+
+    for (int i = 0; !r && i < len; i++) {
+        r = *q1++ - *q2++;
+    }
+    return r;
+}
+
+static void BenchCheckCopy(const char *name, int is_doom) {
+    for (int dst_off = 0; dst_off < BENCH_VECTOR; dst_off++) {
+        for (int src_off = 0; src_off < BENCH_VECTOR; src_off++) {
+            for (int len = 0; len <= BENCH_CHECK_LEN; len++) {
+                BenchFillRandom(g_BenchSrc, BENCH_CHECK_LEN + 2 * BENCH_VECTOR);
+                BenchFillRandom(g_BenchDst, BENCH_CHECK_LEN + 2 * BENCH_VECTOR);
+                memcpy(g_BenchRef, g_BenchDst, BENCH_CHECK_LEN + 2 * BENCH_VECTOR);
+                memcpy(g_BenchRef + dst_off, g_BenchSrc + src_off, len);
+                void *ret = is_doom
+                    ? doom_memcpy(g_BenchDst + dst_off, g_BenchSrc + src_off, len)
+                    : crtdoom_memcpy(g_BenchDst + dst_off, g_BenchSrc + src_off, len);
+                if (ret != g_BenchDst + dst_off
+                    || memcmp(g_BenchDst, g_BenchRef, BENCH_CHECK_LEN + 2 * BENCH_VECTOR) != 0) {
+                    BenchFail(name, dst_off, src_off, len);
+                    return;
+                }
+            }
+        }
+    }
+}
+
+static void BenchCheckFill(const char *name, int is_doom) {
+    for (int dst_off = 0; dst_off < BENCH_VECTOR; dst_off++) {
+        for (int len = 0; len <= BENCH_CHECK_LEN; len++) {
+            int val = BenchRandomByte() | 0x80;
+
+            BenchFillRandom(g_BenchDst, BENCH_CHECK_LEN + 2 * BENCH_VECTOR);
+            memcpy(g_BenchRef, g_BenchDst, BENCH_CHECK_LEN + 2 * BENCH_VECTOR);
+            memset(g_BenchRef + dst_off, val, len);
+            if (is_doom) {
+                doom_memset(g_BenchDst + dst_off, val, len);
+            } else if (crtdoom_memset(g_BenchDst + dst_off, val, len) != g_BenchDst + dst_off) {
+                BenchFail(name, dst_off, 0, len);
+                return;
+            }
+            if (memcmp(g_BenchDst, g_BenchRef, BENCH_CHECK_LEN + 2 * BENCH_VECTOR) != 0) {
+                BenchFail(name, dst_off, 0, len);
+                return;
+            }
+        }
+    }
+}
+
+/* Equal buffers, then one differing byte at every position, above and
+ * below the other so that the sign of the result is checked as well */
+static void BenchCheckCompare(void) {
+    for (int a_off = 0; a_off < BENCH_VECTOR; a_off++) {
+        for (int b_off = 0; b_off < BENCH_VECTOR; b_off++) {
+            for (int len = 0; len <= BENCH_CHECK_LEN; len++) {
+                unsigned char *a = g_BenchSrc + a_off;
+                unsigned char *b = g_BenchDst + b_off;
+
+                BenchFillRandom(a, len);
+                memcpy(b, a, len);
+                if (crtdoom_memcmp(a, b, len) != 0) {
+                    BenchFail("crtdoom_memcmp", b_off, a_off, len);
+                    return;
+                }
+                for (int i = 0; i < len; i++) {
+                    b[i] = a[i] ^ (BenchRandomByte() | 1);
+                    if (crtdoom_memcmp(a, b, len) != BenchByteMemcmp(a, b, len)
+                        || crtdoom_memcmp(b, a, len) != BenchByteMemcmp(b, a, len)) {
+                        BenchFail("crtdoom_memcmp", b_off, a_off, len);
+                        return;
+                    }
+                    b[i] = a[i];
+                }
+            }
+        }
+    }
+}
+
+enum { BENCH_CRT_MEMCPY, BENCH_DOOM_MEMCPY, BENCH_CRT_MEMSET, BENCH_DOOM_MEMSET, BENCH_CRT_MEMCMP, BENCH_BYTE_MEMCMP };
+
+static const char *g_BenchNames[] = {
+    "crtdoom_memcpy", "doom_memcpy", "crtdoom_memset", "doom_memset", "crtdoom_memcmp", "byte memcmp"
+};
+
+/* Nanoseconds per call, repeated for at least BENCH_MIN_NS */
+static double BenchTime(int routine, int dst_off, int src_off, int len) {
+    unsigned char *dst = g_BenchDst + dst_off;
+    unsigned char *src = g_BenchSrc + src_off;
+    long long start = BenchNowNs();
+    long long elapsed;
+    long calls = 0;
+    volatile int sink = 0;
+
+    // memcmp walks the whole length: the buffers are equal
+    memcpy(dst, src, len);
+    do {
+        for (int i = 0; i < 64; i++) {
+            switch (routine) {
+            case BENCH_CRT_MEMCPY:  crtdoom_memcpy(dst, src, len); break;
+            case BENCH_DOOM_MEMCPY: doom_memcpy(dst, src, len); break;
+            case BENCH_CRT_MEMSET:  crtdoom_memset(dst, i, len); break;
+            case BENCH_DOOM_MEMSET: doom_memset(dst, i, len); break;
+            case BENCH_CRT_MEMCMP:  sink += crtdoom_memcmp(dst, src, len); break;
+            default:                sink += BenchByteMemcmp(dst, src, len); break;
+            }
+        }
+        calls += 64;
+        elapsed = BenchNowNs() - start;
+    } while (elapsed < BENCH_MIN_NS);
+    return (double)elapsed / calls;
+}
+
+int main(int argc, char *argv[]) {
+    static const struct { const char *name; int dst_off, src_off, len; } cases[] = {
+        { "frame, aligned",   0, 0, 64000 },
+        { "frame, unaligned", 1, 3, 64000 },
+        { "row, aligned",     0, 0, 320 },
+        { "row, unaligned",   5, 2, 320 },
+        { "< vector",         3, 1, 15 },
+        { "< word",           1, 0, 7 },
+    };
+    int check_only = argc == 2 && strcmp(argv[1], "-check") == 0;
+
+    if (argc > 1 && !check_only) {
+        fprintf(stderr, "usage: %s [-check]\n", argv[0]);
+        return 1;
+    }
+
+    BenchCheckCopy("crtdoom_memcpy", 0);
+    BenchCheckCopy("doom_memcpy", 1);
+    BenchCheckFill("crtdoom_memset", 0);
+    BenchCheckFill("doom_memset", 1);
+    BenchCheckCompare();
+    printf("MEM_BENCH: checks %s\n", g_BenchFailures ? "FAILED" : "passed");
+    if (check_only || g_BenchFailures) {
+        return g_BenchFailures;
+    }
+
+    BenchFillRandom(g_BenchSrc, BENCH_BUF_SIZE);
+    printf("%-18s", "ns per call");
+    for (int r = 0; r <= BENCH_BYTE_MEMCMP; r++) {
+        printf(" %15s", g_BenchNames[r]);
+    }
+    printf("\n");
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        printf("%-18s", cases[c].name);
+        for (int r = 0; r <= BENCH_BYTE_MEMCMP; r++) {
+            printf(" %15.1f", BenchTime(r, cases[c].dst_off, cases[c].src_off, cases[c].len));
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+    return 0;
+}
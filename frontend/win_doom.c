@@ -16,6 +16,11 @@ void EnvPutChar(int c)
     printf("%c", c);
 }
 
+void EnvExit(int code)
+{
+    exit(code);
+}
+
 void WinDoomUpdateTime()
 {
     ULONGLONG time64 = GetTickCount();
@@ -106,10 +111,6 @@ int Win_Repaint(HWND hWnd)
         rdc = CreateCompatibleDC(hdc);
         
         WinDoomUpdateTime();
-        g_WinDoomControlRegs.pixels = g_pDoomWinPixelsBuffer;
-        g_WinDoomControlRegs.height = g_DoomWinHeight;
-        g_WinDoomControlRegs.width = g_DoomWinWidth;
-        
         CrtDoomIteration();
 
         SelectObject(rdc, g_DoomWinBitmap);
@@ -212,6 +213,7 @@ int main(int argc, char *argv[])
     WNDCLASSEX wcex;
     HRESULT hres = 0;
     HWND hWnd;
+    int heapReport = 0;
    
     memset(&wcex, 0, sizeof(wcex));
     wcex.cbSize = sizeof(WNDCLASSEX);
@@ -248,11 +250,24 @@ int main(int argc, char *argv[])
         &g_pDoomWinPixelsBuffer, 0, 0);
     memset(g_pDoomWinPixelsBuffer, 0, g_DoomWinBitmapInfo.bmiHeader.biSizeImage);
 
+    /* Doom renders every frame straight into the DIB section */
+    g_WinDoomControlRegs.pixels = g_pDoomWinPixelsBuffer;
+    g_WinDoomControlRegs.width = g_DoomWinWidth;
+    g_WinDoomControlRegs.height = g_DoomWinHeight;
+    g_WinDoomControlRegs.pitch = g_DoomWinWidth;
+    g_WinDoomControlRegs.format = CRT_DOOM_PIXELS_RGBA;
+
     g_DoomHeapSize =0x4000000;
     g_DoomHeapAddress = HeapAlloc(GetProcessHeap(), 0, g_DoomHeapSize);
     Win_LoadFile("doom.wad");
     CrtDoomInit();
     printf("INITED!!");
+    /* DOOM_HEAP_REPORT=1: heap usage after startup and at exit. */
+    heapReport = getenv("DOOM_HEAP_REPORT") != NULL;
+    if (heapReport)
+    {
+        CrtDoomHeapReport();
+    }
     // Get Messages for window -> Process messages for windwos <- HWND
     while (1)
     {
@@ -263,6 +278,10 @@ int main(int argc, char *argv[])
         {
             if (msg.message == WM_QUIT)
             {
+                if (heapReport)
+                {
+                    CrtDoomHeapReport();
+                }
                 return 0;
             }
             TranslateMessage(&msg);
@@ -480,8 +480,12 @@ long long __ashldi3(long long a, int b)
 
 #endif /* !__x86_64__ */
 
+/* weak, so that the integer-only versions of a soft-float runtime
+   (tcc -msoft-float) can replace them */
+#define SOFTFP_WEAK __attribute__((weak))
+
 /* XXX: fix tcc's code generator to do this instead */
-float __floatundisf(unsigned long long a)
+SOFTFP_WEAK float __floatundisf(unsigned long long a)
 {
     DWunion uu; 
     XFtype r;
@@ -496,7 +500,7 @@ float __floatundisf(unsigned long long a)
     }
 }
 
-double __floatundidf(unsigned long long a)
+SOFTFP_WEAK double __floatundidf(unsigned long long a)
 {
     DWunion uu; 
     XFtype r;
@@ -526,7 +530,7 @@ long double __floatundixf(unsigned long long a)
     }
 }
 
-unsigned long long __fixunssfdi (float a1)
+SOFTFP_WEAK unsigned long long __fixunssfdi (float a1)
 {
     register union float_long fl1;
     register int exp;
@@ -550,14 +554,14 @@ unsigned long long __fixunssfdi (float a1)
         return 0;
 }
 
-long long __fixsfdi (float a1)
+SOFTFP_WEAK long long __fixsfdi (float a1)
 {
     long long ret; int s;
     ret = __fixunssfdi((s = a1 >= 0) ? a1 : -a1);
     return s ? ret : -ret;
 }
 
-unsigned long long __fixunsdfdi (double a1)
+SOFTFP_WEAK unsigned long long __fixunsdfdi (double a1)
 {
     register union double_long dl1;
     register int exp;
@@ -582,7 +586,7 @@ unsigned long long __fixunsdfdi (double a1)
         return 0;
 }
 
-long long __fixdfdi (double a1)
+SOFTFP_WEAK long long __fixdfdi (double a1)
 {
     long long ret; int s;
     ret = __fixunsdfdi((s = a1 >= 0) ? a1 : -a1);
@@ -19,6 +19,12 @@
  */
 
 #include "tcc.h"
+#ifdef _WIN32
+# define PSAPI_VERSION 2 /* GetProcessMemoryInfo from kernel32 */
+# include <psapi.h>
+#else
+# include <sys/resource.h>
+#endif
 
 /********************************************************/
 /* global variables */
@@ -397,6 +403,49 @@ PUB_FUNC void tcc_memcheck(void)
 #define malloc(s) use_tcc_malloc(s)
 #define realloc(p, s) use_tcc_realloc(p, s)
 
+/* memory for data that lives as long as the TCCState (symbols, types,
+   the include cache). It is cut from large chunks and never freed one
+   by one, only all together by tcc_delete() */
+ST_FUNC void *tcc_arena_alloc(TCCState *s1, unsigned size)
+{
+    ArenaChunk *c;
+    void *ptr;
+    unsigned n;
+
+    size = (size + sizeof(ArenaChunk) - 1) & -(int)sizeof(ArenaChunk);
+    if (size > s1->arena_end - s1->arena_ptr) {
+        n = size > ARENA_CHUNK_SIZE / 4 ? size : ARENA_CHUNK_SIZE;
+        c = tcc_malloc(sizeof *c + n);
+        c->size = n;
+        s1->arena_size += n;
+        if (n == size && s1->arena) {
+            /* a big block gets a chunk of its own, the current one
+               stays in use */
+            c->next = s1->arena->next;
+            s1->arena->next = c;
+            return c + 1;
+        }
+        c->next = s1->arena;
+        s1->arena = c;
+        s1->arena_ptr = (char *)(c + 1);
+        s1->arena_end = s1->arena_ptr + n;
+    }
+    ptr = s1->arena_ptr;
+    s1->arena_ptr += size;
+    return ptr;
+}
+
+static void tcc_arena_free(TCCState *s1)
+{
+    ArenaChunk *c;
+
+    while ((c = s1->arena) != NULL) {
+        s1->arena = c->next;
+        tcc_free(c);
+    }
+    s1->arena_ptr = s1->arena_end = NULL;
+}
+
 /********************************************************/
 /* dynarrays */
 
@@ -636,7 +685,9 @@ static int tcc_compile(TCCState *s1)
         s1->error_set_jmp_enabled = 1;
 
         preprocess_start(s1, is_asm);
-        if (s1->output_type == TCC_OUTPUT_PREPROCESS) {
+        if (s1->emit_pch) {
+            tcc_pch_save(s1, define_start);
+        } else if (s1->output_type == TCC_OUTPUT_PREPROCESS) {
             tcc_preprocess(s1);
         } else if (is_asm) {
 #ifdef CONFIG_TCC_ASM
@@ -715,9 +766,7 @@ static void tcc_cleanup(void)
         tcc_close();
     tccpp_delete(tcc_state);
     tcc_state = NULL;
-    /* free sym_pools */
-    dynarray_reset(&sym_pools, &nb_sym_pools);
-    /* reset symbol stack */
+    /* reset symbol stack, the pools are in the arena */
     sym_free_first = NULL;
 }
 
@@ -894,6 +943,8 @@ LIBTCCAPI TCCState *tcc_new(void)
 
 LIBTCCAPI void tcc_delete(TCCState *s1)
 {
+    /* bodies kept across units by -finline-functions */
+    free_leaf_functions(s1, 1);
     tcc_cleanup();
 
     /* free sections */
@@ -904,7 +955,7 @@ LIBTCCAPI void tcc_delete(TCCState *s1)
     dynarray_reset(&s1->crt_paths, &s1->nb_crt_paths);
 
     /* free include paths */
-    dynarray_reset(&s1->cached_includes, &s1->nb_cached_includes);
+    tcc_free(s1->cached_includes);
     dynarray_reset(&s1->include_paths, &s1->nb_include_paths);
     dynarray_reset(&s1->sysinclude_paths, &s1->nb_sysinclude_paths);
     dynarray_reset(&s1->cmd_include_files, &s1->nb_cmd_include_files);
@@ -916,6 +967,9 @@ LIBTCCAPI void tcc_delete(TCCState *s1)
     tcc_free(s1->fini_symbol);
     tcc_free(s1->outfile);
     tcc_free(s1->deps_outfile);
+    tcc_free(s1->cache_dir);
+    tcc_free(s1->job_file);
+    tcc_free(s1->pch_file);
     dynarray_reset(&s1->files, &s1->nb_files);
     dynarray_reset(&s1->target_deps, &s1->nb_target_deps);
     dynarray_reset(&s1->pragma_libs, &s1->nb_pragma_libs);
@@ -926,6 +980,7 @@ LIBTCCAPI void tcc_delete(TCCState *s1)
     tcc_run_free(s1);
 #endif
 
+    tcc_arena_free(s1);
     tcc_free(s1);
     if (0 == --nb_states)
         tcc_memcheck();
@@ -941,6 +996,10 @@ LIBTCCAPI int tcc_set_output_type(TCCState *s, int output_type)
 
     if (s->char_is_unsigned)
         tcc_define_symbol(s, "__CHAR_UNSIGNED__", NULL);
+#ifdef TCC_TARGET_I386
+    if (s->soft_float)
+        tcc_define_symbol(s, "__SOFTFP__", NULL);
+#endif
 
     if (!s->nostdinc) {
         /* default include paths */
@@ -1080,7 +1139,7 @@ LIBTCCAPI int tcc_add_file(TCCState *s, const char *filename)
                 filetype = AFF_TYPE_ASMPP;
             else if (!strcmp(ext, "s"))
                 filetype = AFF_TYPE_ASM;
-            else if (!PATHCMP(ext, "c") || !PATHCMP(ext, "i"))
+            else if (!PATHCMP(ext, "c") || !PATHCMP(ext, "i") || s->emit_pch)
                 filetype = AFF_TYPE_C;
             else
                 flags |= AFF_TYPE_BIN;
@@ -1370,6 +1429,12 @@ static int tcc_set_linker(TCCState *s, const char *option)
             s->rdynamic = 1;
         } else if (link_option(option, "rpath=", &p)) {
             copy_linker_arg(&s->rpath, p, ':');
+        } else if (ret = link_option(option, "?gc-sections", &p), ret) {
+            s->gc_sections = ret > 0;
+        } else if (link_option(option, "print-gc-sections", &p)) {
+            s->print_gc_sections = 1;
+        } else if (link_option(option, "print-function-sizes", &p)) {
+            s->print_func_sizes = 1;
         } else if (link_option(option, "enable-new-dtags", &p)) {
             s->enable_new_dtags = 1;
         } else if (link_option(option, "section-alignment=", &p)) {
@@ -1466,7 +1531,9 @@ enum {
     TCC_OPTION_f,
     TCC_OPTION_isystem,
     TCC_OPTION_iwithprefix,
+    TCC_OPTION_include_pch,
     TCC_OPTION_include,
+    TCC_OPTION_emit_pch,
     TCC_OPTION_nostdinc,
     TCC_OPTION_nostdlib,
     TCC_OPTION_print_search_dirs,
@@ -1480,6 +1547,9 @@ enum {
     TCC_OPTION_E,
     TCC_OPTION_MD,
     TCC_OPTION_MF,
+    TCC_OPTION_jfile,
+    TCC_OPTION_j,
+    TCC_OPTION_cache_dir,
     TCC_OPTION_x,
     TCC_OPTION_ar,
     TCC_OPTION_impdef
@@ -1535,7 +1605,9 @@ static const TCCOption tcc_options[] = {
     { "m", TCC_OPTION_m, TCC_OPTION_HAS_ARG | TCC_OPTION_NOSEP },
     { "f", TCC_OPTION_f, TCC_OPTION_HAS_ARG | TCC_OPTION_NOSEP },
     { "isystem", TCC_OPTION_isystem, TCC_OPTION_HAS_ARG },
+    { "include-pch", TCC_OPTION_include_pch, TCC_OPTION_HAS_ARG },
     { "include", TCC_OPTION_include, TCC_OPTION_HAS_ARG },
+    { "emit-pch", TCC_OPTION_emit_pch, 0 },
     { "nostdinc", TCC_OPTION_nostdinc, 0 },
     { "nostdlib", TCC_OPTION_nostdlib, 0 },
     { "print-search-dirs", TCC_OPTION_print_search_dirs, 0 },
@@ -1544,6 +1616,9 @@ static const TCCOption tcc_options[] = {
     { "E", TCC_OPTION_E, 0},
     { "MD", TCC_OPTION_MD, 0},
     { "MF", TCC_OPTION_MF, TCC_OPTION_HAS_ARG },
+    { "jfile", TCC_OPTION_jfile, TCC_OPTION_HAS_ARG },
+    { "j", TCC_OPTION_j, TCC_OPTION_HAS_ARG | TCC_OPTION_NOSEP },
+    { "cache-dir", TCC_OPTION_cache_dir, TCC_OPTION_HAS_ARG },
     { "x", TCC_OPTION_x, TCC_OPTION_HAS_ARG },
     { "ar", TCC_OPTION_ar, 0},
 #ifdef TCC_TARGET_PE
@@ -1570,6 +1645,9 @@ static const FlagDef options_f[] = {
     { offsetof(TCCState, leading_underscore), 0, "leading-underscore" },
     { offsetof(TCCState, ms_extensions), 0, "ms-extensions" },
     { offsetof(TCCState, dollars_in_identifiers), 0, "dollars-in-identifiers" },
+    { offsetof(TCCState, inline_functions), 0, "inline-functions" },
+    { offsetof(TCCState, function_sections), 0, "function-sections" },
+    { offsetof(TCCState, data_sections), 0, "data-sections" },
     { 0, 0, NULL }
 };
 
@@ -1577,6 +1655,10 @@ static const FlagDef options_m[] = {
     { offsetof(TCCState, ms_bitfields), 0, "ms-bitfields" },
 #ifdef TCC_TARGET_X86_64
     { offsetof(TCCState, nosse), FD_INVERT, "sse" },
+#endif
+#ifdef TCC_TARGET_I386
+    { offsetof(TCCState, soft_float), 0, "soft-float" },
+    { offsetof(TCCState, soft_float), FD_INVERT, "hard-float" },
 #endif
     { 0, 0, NULL }
 };
@@ -1817,6 +1899,14 @@ reparse:
 	    dynarray_add(&s->cmd_include_files,
 			 &s->nb_cmd_include_files, tcc_strdup(optarg));
 	    break;
+        case TCC_OPTION_include_pch:
+            tcc_free(s->pch_file);
+            s->pch_file = tcc_strdup(optarg);
+            break;
+        case TCC_OPTION_emit_pch:
+            s->emit_pch = 1;
+            x = TCC_OUTPUT_PREPROCESS;
+            goto set_output_type;
         case TCC_OPTION_nostdinc:
             s->nostdinc = 1;
             break;
@@ -1891,6 +1981,18 @@ reparse:
         case TCC_OPTION_MF:
             s->deps_outfile = tcc_strdup(optarg);
             break;
+        case TCC_OPTION_j:
+            /* -j alone: one job per processor */
+            s->nb_jobs = *optarg ? atoi(optarg) : -1;
+            break;
+        case TCC_OPTION_jfile:
+            tcc_free(s->job_file);
+            s->job_file = tcc_strdup(optarg);
+            break;
+        case TCC_OPTION_cache_dir:
+            tcc_free(s->cache_dir);
+            s->cache_dir = tcc_strdup(optarg);
+            break;
         case TCC_OPTION_dumpversion:
             printf ("%s\n", TCC_VERSION);
             exit(0);
@@ -1963,6 +2065,26 @@ LIBTCCAPI void tcc_set_options(TCCState *s, const char *r)
     dynarray_reset(&argv, &argc);
 }
 
+/* peak resident size of the process in bytes */
+static unsigned long peak_memory(void)
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof pmc))
+        return pmc.PeakWorkingSetSize;
+    return 0;
+#else
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru))
+        return 0;
+# ifdef __APPLE__
+    return ru.ru_maxrss;
+# else
+    return ru.ru_maxrss * 1024UL;
+# endif
+#endif
+}
+
 PUB_FUNC void tcc_print_stats(TCCState *s, unsigned total_time)
 {
     if (total_time < 1)
@@ -1975,6 +2097,10 @@ PUB_FUNC void tcc_print_stats(TCCState *s, unsigned total_time)
            (double)total_time/1000,
            (unsigned)total_lines*1000/total_time,
            (double)total_bytes/1000/total_time);
+    fprintf(stderr, "* %d includes opened, %d skipped by guard or #pragma once\n",
+           total_includes, total_includes_skipped);
+    fprintf(stderr, "* %lu KB in arena, %lu KB peak memory\n",
+           s->arena_size >> 10, peak_memory() >> 10);
 #ifdef MEM_DEBUG
     fprintf(stderr, "* %d bytes memory used\n", mem_max_size);
 #endif
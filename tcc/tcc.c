@@ -23,6 +23,9 @@
 # include "libtcc.c"
 #endif
 #include "tcctools.c"
+#ifndef _WIN32
+# include <sys/stat.h> /* mkdir() */
+#endif
 
 static const char help[] =
     "Tiny C Compiler "TCC_VERSION" - Copyright (C) 2001-2006 Fabrice Bellard\n"
@@ -38,6 +41,7 @@ static const char help[] =
     "  -v -vv      show version, show search paths or loaded files\n"
     "  -h -hh      show this, show more help\n"
     "  -bench      show compilation statistics\n"
+    "  -j[N]       compile C files on N processes (default: one per cpu)\n"
     "  -           use stdin pipe as infile\n"
     "  @listfile   read arguments from listfile\n"
     "Preprocessor options:\n"
@@ -85,11 +89,15 @@ static const char help2[] =
     "  -On                           same as -D__OPTIMIZE__ for n > 0\n"
     "  -Wp,-opt                      same as -opt\n"
     "  -include file                 include 'file' above each input file\n"
+    "  -emit-pch                     with -o: write a precompiled header\n"
+    "  -include-pch file             load the precompiled header 'file' first\n"
     "  -isystem dir                  add 'dir' to system include path\n"
     "  -static                       link to static libraries (not recommended)\n"
     "  -dumpversion                  print version\n"
     "  -print-search-dirs            print search paths\n"
     "  -dt                           with -run/-E: auto-define 'test_...' macros\n"
+    "  -cache-dir dir                keep objects in 'dir', reuse them for\n"
+    "                                unchanged preprocessed sources\n"
     "Ignored options:\n"
     "  --param  -pedantic  -pipe  -s  -std  -traditional\n"
     "-W... warnings:\n"
@@ -105,6 +113,9 @@ static const char help2[] =
     "  leading-underscore            decorate extern symbols\n"
     "  ms-extensions                 allow anonymous struct in struct\n"
     "  dollars-in-identifiers        allow '$' in C symbols\n"
+    "  function-sections             each function in its own section\n"
+    "  data-sections                 each global in its own section\n"
+    "  inline-functions              expand small leaf functions at calls\n"
     "-m... target specific options:\n"
     "  ms-bitfields                  use MSVC bitfield layout\n"
 #ifdef TCC_TARGET_ARM
@@ -112,6 +123,9 @@ static const char help2[] =
 #endif
 #ifdef TCC_TARGET_X86_64
     "  no-sse                        disable floats on x86_64\n"
+#endif
+#ifdef TCC_TARGET_I386
+    "  soft-float                    float/double via runtime calls\n"
 #endif
     "-Wl,... linker options:\n"
     "  -nostdlib                     do not link with standard crt/libs\n"
@@ -132,6 +146,9 @@ static const char help2[] =
     "  -enable-new-dtags             set DT_RUNPATH instead of DT_RPATH\n"
     "  -soname=                      set DT_SONAME elf tag\n"
     "  -Bsymbolic                    set DT_SYMBOLIC elf tag\n"
+    "  -[no-]gc-sections             drop unreferenced sections\n"
+    "  -print-gc-sections            list the dropped sections\n"
+    "  -print-function-sizes         list the size of each function\n"
     "  -oformat=[elf32/64-* binary]  set executable output format\n"
     "  -init= -fini= -as-needed -O   (ignored)\n"
     "Predefined macros:\n"
@@ -243,6 +260,233 @@ static unsigned getclock_ms(void)
 #endif
 }
 
+/* -------------------------------------------------------------- */
+/* -j and -cache-dir: the C files are compiled by worker processes,
+   'tcc <same args> -jfile <n>:<object>', and their objects linked */
+
+static int is_job_file(struct filespec *f)
+{
+    const char *ext;
+
+    if (f->type != AFF_TYPE_NONE)
+        return f->type == AFF_TYPE_C;
+    if (!strcmp(f->name, "-"))
+        return 0;
+    ext = tcc_fileextension(f->name);
+    return !*ext || !PATHCMP(ext, ".c") || !PATHCMP(ext, ".i");
+}
+
+static unsigned long long hash_bytes(unsigned long long h, const void *p, size_t n)
+{
+    const unsigned char *b = p;
+    while (n--)
+        h = (h ^ *b++) * 0x100000001b3ULL; /* FNV-1a */
+    return h;
+}
+
+/* the options that can change the object. Those of the driver and the
+   linker cannot, and -I -D -U show in the preprocessed source */
+static unsigned long long hash_options(int argc, char **argv)
+{
+    static const char id[] = "tcc " TCC_VERSION " " __DATE__ " " __TIME__;
+    unsigned long long h = hash_bytes(0xcbf29ce484222325ULL, id, sizeof id);
+    int i;
+
+    for (i = 1; i < argc; ++i) {
+        const char *a = argv[i];
+        if (a[0] != '-' || strchr("ocjlLBIDUMv", a[1])
+            || !strcmp(a, "-bench") || !strncmp(a, "-Wl,", 4))
+            continue;
+        h = hash_bytes(h, a, strlen(a) + 1);
+    }
+    return h;
+}
+
+static int hash_file(unsigned long long *ph, const char *filename)
+{
+    char buf[4096];
+    size_t n;
+    FILE *f = fopen(filename, "rb");
+
+    if (!f)
+        return -1;
+    while ((n = fread(buf, 1, sizeof buf, f)) > 0)
+        *ph = hash_bytes(*ph, buf, n);
+    fclose(f);
+    return 0;
+}
+
+static int copy_file(const char *from, const char *to)
+{
+    char buf[4096];
+    size_t n;
+    int ret = 0;
+    FILE *in, *out;
+
+    in = fopen(from, "rb");
+    if (!in)
+        return -1;
+    out = fopen(to, "wb");
+    if (!out) {
+        fclose(in);
+        return -1;
+    }
+    while ((n = fread(buf, 1, sizeof buf, in)) > 0)
+        if (fwrite(buf, 1, n, out) != n)
+            ret = -1;
+    fclose(in);
+    if (fclose(out))
+        ret = -1;
+    return ret;
+}
+
+static TCCState *job_state(int argc, char **argv, int output_type)
+{
+    TCCState *s = tcc_new();
+    tcc_parse_args(s, &argc, &argv, 1);
+    set_environment(s);
+    tcc_set_output_type(s, output_type);
+    return s;
+}
+
+/* worker: compile file 'n' of the command line to 'object'. With a
+   cache, the preprocessed source and the options are hashed first and
+   a cached object for the hash is used when there is one. */
+static int compile_job(TCCState *s, int argc, char **argv, int argc0, char **argv0)
+{
+    char obj[1024], cached[1024], tmp[sizeof obj + sizeof cached];
+    char *name, *cache_dir = NULL, *p;
+    unsigned long long h;
+    int n, type, verbose, ret;
+
+    n = strtol(s->job_file, &p, 10);
+    if (*p != ':' || n < 0 || n >= s->nb_files)
+        tcc_error("invalid -jfile '%s'", s->job_file);
+    pstrcpy(obj, sizeof obj, p + 1);
+    name = tcc_strdup(s->files[n]->name);
+    type = s->files[n]->type;
+    verbose = s->verbose;
+    h = hash_options(argc, argv);
+    if (s->cache_dir) {
+        /* room for "/<hash>.o" */
+        if (strlen(s->cache_dir) + 20 > sizeof cached)
+            tcc_error("cache directory name too long '%s'", s->cache_dir);
+        cache_dir = tcc_strdup(s->cache_dir);
+    }
+    tcc_delete(s);
+
+    if (cache_dir) {
+        snprintf(tmp, sizeof tmp, "%s.i", obj);
+        s = job_state(argc0, argv0, TCC_OUTPUT_PREPROCESS);
+        s->ppfp = fopen(tmp, "wb");
+        if (!s->ppfp)
+            tcc_error("could not write '%s'", tmp);
+        s->filetype = type;
+        ret = tcc_add_file(s, name) < 0;
+        fclose(s->ppfp);
+        tcc_delete(s);
+        if (!ret)
+            ret = hash_file(&h, tmp);
+        remove(tmp);
+        if (ret)
+            goto done;
+        snprintf(cached, sizeof cached, "%s/%016llx.o", cache_dir, h);
+        if (0 == copy_file(cached, obj)) {
+            if (1 == verbose)
+                printf("-> %s (cached)\n", name);
+            goto done;
+        }
+    }
+
+    s = job_state(argc0, argv0, TCC_OUTPUT_OBJ);
+    if (1 == s->verbose)
+        printf("-> %s\n", name);
+    s->filetype = type;
+    ret = tcc_add_file(s, name) < 0 || tcc_output_file(s, obj);
+    tcc_delete(s);
+    if (cache_dir && !ret) {
+        /* other workers may look for the same object meanwhile */
+        snprintf(tmp, sizeof tmp, "%s.%s", cached, tcc_basename(obj));
+        if (copy_file(obj, tmp) || rename(tmp, cached))
+            remove(tmp);
+    }
+done:
+    tcc_free(name);
+    tcc_free(cache_dir);
+    return ret;
+}
+
+static void remove_files(char ***files, int *nb_files)
+{
+    int i;
+    for (i = 0; i < *nb_files; ++i)
+        remove((*files)[i]);
+    dynarray_reset(files, nb_files);
+}
+
+/* parent: run the workers. When linking, the objects replace the C files
+   on the command line and are listed in 'tmp_objs' for removal. */
+static int compile_jobs(TCCState *s, int argc0, char **argv0,
+                        char ***tmp_objs, int *nb_tmp_objs)
+{
+    char ***cmds = NULL, **cmd, buf[1024], *obj;
+    int nb_cmds = 0, nb_cmd, i, j, ret;
+    int objs_only = s->output_type == TCC_OUTPUT_OBJ && !s->option_r;
+    struct filespec *f;
+
+    if (s->cache_dir)
+#ifdef _WIN32
+        _mkdir(s->cache_dir);
+#else
+        mkdir(s->cache_dir, 0777);
+#endif
+    if (!objs_only && !s->outfile) {
+        for (i = 0; i < s->nb_files && s->files[i]->type == AFF_TYPE_LIB; ++i)
+            ;
+        s->outfile = default_outputfile(s, i < s->nb_files ? s->files[i]->name : NULL);
+    }
+
+    for (i = 0; i < s->nb_files; ++i) {
+        f = s->files[i];
+        if (!is_job_file(f))
+            continue;
+        if (!objs_only) {
+            snprintf(buf, sizeof buf, "%s.%d.o", s->outfile, i);
+            obj = tcc_strdup(buf);
+        } else if (s->outfile) {
+            obj = tcc_strdup(s->outfile);
+        } else {
+            obj = default_outputfile(s, f->name);
+        }
+        cmd = NULL, nb_cmd = 0;
+        for (j = 0; j < argc0; ++j)
+            dynarray_add(&cmd, &nb_cmd, argv0[j]);
+        dynarray_add(&cmd, &nb_cmd, "-jfile");
+        snprintf(buf, sizeof buf, "%d:%s", i, obj);
+        dynarray_add(&cmd, &nb_cmd, tcc_strdup(buf));
+        dynarray_add(&cmd, &nb_cmd, NULL);
+        dynarray_add(&cmds, &nb_cmds, cmd);
+        if (!objs_only) {
+            s->files[i] = tcc_malloc(sizeof *f + strlen(obj));
+            s->files[i]->type = AFF_TYPE_NONE;
+            s->files[i]->alacarte = f->alacarte;
+            strcpy(s->files[i]->name, obj);
+            tcc_free(f);
+            dynarray_add(tmp_objs, nb_tmp_objs, obj);
+        } else {
+            tcc_free(obj);
+        }
+    }
+
+    ret = tcc_tool_jobs(cmds, nb_cmds, s->nb_jobs ? s->nb_jobs : 1);
+    for (i = 0; i < nb_cmds; ++i) {
+        tcc_free(cmds[i][argc0 + 1]);
+        tcc_free(cmds[i]);
+    }
+    tcc_free(cmds);
+    return ret;
+}
+
 int main(int argc0, char **argv0)
 {
     TCCState *s;
@@ -251,12 +495,17 @@ int main(int argc0, char **argv0)
     const char *first_file;
     int argc; char **argv;
     FILE *ppfp = stdout;
+    char **tmp_objs = NULL;
+    int nb_tmp_objs = 0;
 
 redo:
     argc = argc0, argv = argv0;
     s = tcc_new();
     opt = tcc_parse_args(s, &argc, &argv, 1);
 
+    if (s->job_file)
+        return compile_job(s, argc, argv, argc0, argv0);
+
     if ((n | t) == 0) {
         if (opt == OPT_HELP)
             return printf(help), 1;
@@ -286,7 +535,13 @@ redo:
         if (n == 0)
             tcc_error("no input files\n");
 
-        if (s->output_type == TCC_OUTPUT_PREPROCESS) {
+        if (s->emit_pch) {
+            if (!s->outfile || n > 1)
+                tcc_error("-emit-pch needs one header and -o");
+            ppfp = fopen(s->outfile, "wb");
+            if (!ppfp)
+                tcc_error("could not write '%s'", s->outfile);
+        } else if (s->output_type == TCC_OUTPUT_PREPROCESS) {
             if (s->outfile) {
                 ppfp = fopen(s->outfile, "w");
                 if (!ppfp)
@@ -312,6 +567,17 @@ redo:
     tcc_set_output_type(s, s->output_type);
     s->ppfp = ppfp;
 
+    if ((s->nb_jobs || s->cache_dir) && n == s->nb_files && !t && !s->gen_deps
+        && s->output_type != TCC_OUTPUT_MEMORY
+        && s->output_type != TCC_OUTPUT_PREPROCESS) {
+        ret = compile_jobs(s, argc0, argv0, &tmp_objs, &nb_tmp_objs);
+        if (ret || (s->output_type == TCC_OUTPUT_OBJ && !s->option_r)) {
+            tcc_delete(s);
+            remove_files(&tmp_objs, &nb_tmp_objs);
+            return ret;
+        }
+    }
+
     if ((s->output_type == TCC_OUTPUT_MEMORY
       || s->output_type == TCC_OUTPUT_PREPROCESS) && (s->dflag & 16))
         s->dflag |= t ? 32 : 0, s->run_test = ++t, n = s->nb_files;
@@ -342,7 +608,11 @@ redo:
     if (s->run_test) {
         t = 0;
     } else if (s->output_type == TCC_OUTPUT_PREPROCESS) {
-        ;
+        if (ret && s->emit_pch) {
+            /* no half written header for the next compile to trip on */
+            fclose(ppfp), ppfp = NULL;
+            remove(s->outfile);
+        }
     } else if (0 == ret) {
         if (s->output_type == TCC_OUTPUT_MEMORY) {
 #ifdef TCC_IS_NATIVE
@@ -361,6 +631,7 @@ redo:
     if (s->do_bench && (n | t | ret) == 0)
         tcc_print_stats(s, getclock_ms() - start_time);
     tcc_delete(s);
+    remove_files(&tmp_objs, &nb_tmp_objs);
     if (ret == 0 && n)
         goto redo; /* compile more files with -c */
     if (t)
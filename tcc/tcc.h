@@ -592,6 +592,27 @@ typedef struct InlineFunc {
     char filename[1];
 } InlineFunc;
 
+#define LEAF_MAX_PARAMS 8
+#define LEAF_MAX_NAMES 16
+
+/* small function that -finline-functions expands at its call sites */
+typedef struct LeafFunc {
+    Sym *sym; /* the function, NULL once its unit is finished */
+    int v; /* its name */
+    TokenString *func_str; /* the body, from '{' */
+    CType type; /* return type */
+    int nb_params;
+    int param_v[LEAF_MAX_PARAMS];
+    CType param[LEAF_MAX_PARAMS];
+    int nb_names;
+    int names[LEAF_MAX_NAMES]; /* other identifiers the body refers to */
+    unsigned assigned; /* parameters written or address-taken in the body */
+    unsigned char is_expr; /* the body is '{ return expr; }' */
+    unsigned char pure; /* the body stores nothing */
+    unsigned char global; /* the body uses nothing but its parameters, so it
+                             can be expanded in later units too */
+} LeafFunc;
+
 /* include file cache, used to find files faster and also to eliminate
    inclusion if the include file is protected by #ifndef ... #endif */
 typedef struct CachedInclude {
@@ -603,6 +624,14 @@ typedef struct CachedInclude {
 
 #define CACHED_INCLUDES_HASH_SIZE 32
 
+/* arena of blocks released together by tcc_delete() */
+typedef struct ArenaChunk {
+    struct ArenaChunk *next;
+    size_t size;
+} ArenaChunk;
+
+#define ARENA_CHUNK_SIZE (64 * 1024)
+
 #ifdef CONFIG_TCC_ASM
 typedef struct ExprValue {
     uint64_t v;
@@ -647,6 +676,9 @@ struct TCCState {
     int rdynamic; /* if true, all symbols are exported */
     int symbolic; /* if true, resolve symbols in the current module first */
     int alacarte_link; /* if true, only link in referenced objects from archive */
+    int gc_sections; /* if true, drop unreferenced sections from executables */
+    int print_gc_sections; /* list the sections dropped by gc_sections */
+    int print_func_sizes; /* list the functions in the output with their size */
 
     char *tcc_lib_path; /* CONFIG_TCCDIR or -B option */
     char *soname; /* as specified on the command line (-soname) */
@@ -664,6 +696,9 @@ struct TCCState {
     int ms_extensions;	/* allow nested named struct w/o identifier behave like unnamed */
     int dollars_in_identifiers;	/* allows '$' char in identifiers */
     int ms_bitfields; /* if true, emulate MS algorithm for aligning bitfields */
+    int inline_functions; /* expand small leaf functions at call sites */
+    int function_sections; /* put each function in its own .text.<name> */
+    int data_sections; /* put each global in its own .data.<name>/.bss.<name> */
 
     /* warning switches */
     int warn_write_strings;
@@ -694,6 +729,7 @@ struct TCCState {
 
 #ifdef TCC_TARGET_I386
     int seg_size; /* 32. Can be 16 with i386 assembler (.code16) */
+    int soft_float; /* -msoft-float: float/double through runtime calls */
 #endif
 #ifdef TCC_TARGET_X86_64
     int nosse; /* For -mno-sse support. */
@@ -721,6 +757,8 @@ struct TCCState {
     /* -include files */
     char **cmd_include_files;
     int nb_cmd_include_files;
+    char *pch_file; /* -include-pch */
+    unsigned char emit_pch; /* -emit-pch */
 
     /* error handling */
     void *error_opaque;
@@ -755,6 +793,11 @@ struct TCCState {
     CachedInclude **cached_includes;
     int nb_cached_includes;
 
+    /* tcc_arena_alloc() */
+    ArenaChunk *arena;
+    char *arena_ptr, *arena_end;
+    unsigned long arena_size;
+
     /* #pragma pack stack */
     int pack_stack[PACK_STACK_SIZE];
     int *pack_stack_ptr;
@@ -765,6 +808,8 @@ struct TCCState {
        only if referenced */
     struct InlineFunc **inline_fns;
     int nb_inline_fns;
+    struct LeafFunc **leaf_fns;
+    int nb_leaf_fns;
 
     /* sections */
     Section **sections;
@@ -817,6 +862,9 @@ struct TCCState {
     int do_bench; /* option -bench */
     int gen_deps; /* option -MD  */
     char *deps_outfile; /* option -MF */
+    int nb_jobs; /* option -j, -1 for one per processor */
+    char *cache_dir; /* option -cache-dir */
+    char *job_file; /* "<file index>:<object>" on a -j worker */
     int option_pthread; /* -pthread option */
     int argc;
     char **argv;
@@ -1118,6 +1166,7 @@ PUB_FUNC char *tcc_strdup_debug(const char *str, const char *file, int line);
 #undef strdup
 #define strdup(s) use_tcc_strdup(s)
 PUB_FUNC void tcc_memcheck(void);
+ST_FUNC void *tcc_arena_alloc(TCCState *s1, unsigned size);
 PUB_FUNC void tcc_error_noabort(const char *fmt, ...);
 PUB_FUNC NORETURN void tcc_error(const char *fmt, ...);
 PUB_FUNC void tcc_warning(const char *fmt, ...);
@@ -1196,6 +1245,8 @@ ST_DATA CString tokcstr; /* current parsed string, if any */
 /* display benchmark infos */
 ST_DATA int total_lines;
 ST_DATA int total_bytes;
+ST_DATA int total_includes;
+ST_DATA int total_includes_skipped;
 ST_DATA int tok_ident;
 ST_DATA TokenSym **table_ident;
 
@@ -1247,6 +1298,7 @@ ST_FUNC void preprocess_end(TCCState *s1);
 ST_FUNC void tccpp_new(TCCState *s);
 ST_FUNC void tccpp_delete(TCCState *s);
 ST_FUNC int tcc_preprocess(TCCState *s1);
+ST_FUNC void tcc_pch_save(TCCState *s1, Sym *define_start);
 ST_FUNC void skip(int c);
 ST_FUNC NORETURN void expect(const char *msg);
 
@@ -1271,8 +1323,6 @@ static inline int toup(int c) {
 
 #define SYM_POOL_NB (8192 / sizeof(Sym))
 ST_DATA Sym *sym_free_first;
-ST_DATA void **sym_pools;
-ST_DATA int nb_sym_pools;
 
 ST_DATA Sym *global_stack;
 ST_DATA Sym *local_stack;
@@ -1302,6 +1352,7 @@ ST_FUNC void tcc_debug_line(TCCState *s1);
 
 ST_FUNC int tccgen_compile(TCCState *s1);
 ST_FUNC void free_inline_functions(TCCState *s);
+ST_FUNC void free_leaf_functions(TCCState *s, int all);
 ST_FUNC void check_vstack(void);
 
 ST_INLN int is_float(int t);
@@ -1647,6 +1698,7 @@ ST_FUNC int tcc_tool_impdef(TCCState *s, int argc, char **argv);
 #endif
 ST_FUNC void tcc_tool_cross(TCCState *s, char **argv, int option);
 ST_FUNC void gen_makedeps(TCCState *s, const char *target, const char *filename);
+ST_FUNC int tcc_tool_jobs(char ***cmds, int nb_cmds, int nb_jobs);
 #endif
 
 /********************************************************/
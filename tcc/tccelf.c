@@ -1287,6 +1287,207 @@ ST_FUNC void resolve_common_syms(TCCState *s1)
     tcc_add_linker_symbols(s1);
 }
 
+/* a section that -ffunction-sections/-fdata-sections (or another
+   compiler) split off for a single function or object: returns the
+   length of the name of the section it belongs to, '.text' etc. */
+static int is_split_section(Section *s)
+{
+    static const char * const prefix[] = {
+        ".text.", ".data.", ".bss.", ".rodata.", NULL
+    };
+    const char * const *p;
+    int len;
+
+    if (!(s->sh_flags & SHF_ALLOC))
+        return 0;
+    for (p = prefix; *p; p++) {
+        len = strlen(*p);
+        if (!strncmp(s->name, *p, len))
+            return len - 1;
+    }
+    return 0;
+}
+
+static void gc_mark_section(int sh_num, char *live, int *stack, int *sp)
+{
+    if (sh_num == SHN_UNDEF || sh_num >= SHN_LORESERVE || live[sh_num])
+        return;
+    live[sh_num] = 1;
+    stack[(*sp)++] = sh_num;
+}
+
+/* -Wl,--gc-sections: drop the split sections that nothing reachable from
+   the entry point or from an unsplit section refers to */
+static void gc_sections(TCCState *s1)
+{
+    int i, sp, nb, sym_index, *stack;
+    unsigned long removed;
+    char *live;
+    Section *s, *sr;
+    ElfW(Sym) *sym;
+    ElfW_Rel *rel;
+
+    nb = s1->nb_sections;
+    live = tcc_mallocz(nb);
+    stack = tcc_malloc(nb * sizeof(int));
+    sp = 0;
+
+    /* roots: everything that was not split, the entry point and, for
+       -rdynamic, all exported symbols */
+    for (i = 1; i < nb; i++) {
+        s = s1->sections[i];
+        if ((s->sh_flags & SHF_ALLOC) && !is_split_section(s))
+            gc_mark_section(i, live, stack, &sp);
+    }
+    sym_index = find_elf_sym(symtab_section, "_start");
+    if (sym_index)
+        gc_mark_section(((ElfW(Sym) *)symtab_section->data)[sym_index].st_shndx,
+                        live, stack, &sp);
+    if (s1->rdynamic) {
+        for_each_elem(symtab_section, 1, sym, ElfW(Sym))
+            if (ELFW(ST_BIND)(sym->st_info) != STB_LOCAL)
+                gc_mark_section(sym->st_shndx, live, stack, &sp);
+    }
+
+    /* a live section keeps alive what its relocations point to */
+    while (sp > 0) {
+        sr = s1->sections[stack[--sp]]->reloc;
+        if (!sr)
+            continue;
+        for_each_elem(sr, 0, rel, ElfW_Rel) {
+            sym = &((ElfW(Sym) *)symtab_section->data)[ELFW(R_SYM)(rel->r_info)];
+            gc_mark_section(sym->st_shndx, live, stack, &sp);
+        }
+    }
+
+    /* empty the dead sections (live = 2); without SHF_ALLOC and data
+       they get no name and are not output at all */
+    removed = 0;
+    for (i = 1; i < nb; i++) {
+        s = s1->sections[i];
+        if (live[i] || !is_split_section(s))
+            continue;
+        if (s1->print_gc_sections)
+            fprintf(stderr, "tcc: removing unused section '%s' (%lu bytes)\n",
+                    s->name, (unsigned long)s->data_offset);
+        removed += s->data_offset;
+        live[i] = 2;
+        s->data_offset = 0;
+        s->sh_flags &= ~SHF_ALLOC;
+        if (s->reloc)
+            s->reloc->data_offset = 0;
+    }
+
+    /* references from debug info to dead symbols resolve to 0 */
+    for_each_elem(symtab_section, 1, sym, ElfW(Sym)) {
+        if (sym->st_shndx < SHN_LORESERVE && live[sym->st_shndx] == 2) {
+            sym->st_shndx = SHN_ABS;
+            sym->st_value = 0;
+            sym->st_size = 0;
+        }
+    }
+    if (s1->print_gc_sections)
+        fprintf(stderr, "tcc: removed %lu bytes\n", removed);
+
+    tcc_free(stack);
+    tcc_free(live);
+}
+
+/* fold the split sections back into .text, .data, .bss and .rodata, as
+   one section per function would only bloat the section header table */
+static void merge_split_sections(TCCState *s1)
+{
+    int i, j, len, nb, *base;
+    char name[16];
+    Section *s, *sr, **parent;
+    ElfW(Sym) *sym;
+    ElfW_Rel *rel;
+    addr_t addend;
+
+    nb = s1->nb_sections;
+    parent = tcc_mallocz(nb * sizeof(Section *));
+    base = tcc_malloc(nb * sizeof(int));
+    for (i = 1; i < nb; i++) {
+        s = s1->sections[i];
+        len = is_split_section(s);
+        if (!len)
+            continue;
+        pstrncpy(name, s->name, len);
+        for (j = 1; j < s1->nb_sections; j++)
+            if (!strcmp(s1->sections[j]->name, name))
+                break;
+        if (j < s1->nb_sections)
+            parent[i] = s1->sections[j];
+        else
+            parent[i] = new_section(s1, name, s->sh_type, s->sh_flags);
+        base[i] = section_add(parent[i], s->data_offset, s->sh_addralign);
+        if (s->sh_type != SHT_NOBITS)
+            memcpy(parent[i]->data + base[i], s->data, s->data_offset);
+        sr = s->reloc;
+        if (sr) {
+            for_each_elem(sr, 0, rel, ElfW_Rel) {
+                addend = 0;
+#if SHT_RELX == SHT_RELA
+                addend = rel->r_addend;
+#endif
+                put_elf_reloca(symtab_section, parent[i], base[i] + rel->r_offset,
+                               ELFW(R_TYPE)(rel->r_info),
+                               ELFW(R_SYM)(rel->r_info), addend);
+            }
+            sr->data_offset = 0;
+        }
+        s->data_offset = 0;
+        s->sh_flags &= ~SHF_ALLOC;
+    }
+    for_each_elem(symtab_section, 1, sym, ElfW(Sym)) {
+        if (sym->st_shndx < nb && parent[sym->st_shndx]) {
+            sym->st_value += base[sym->st_shndx];
+            sym->st_shndx = parent[sym->st_shndx]->sh_num;
+        }
+    }
+    tcc_free(base);
+    tcc_free(parent);
+}
+
+static int cmp_func_size(const void *a, const void *b)
+{
+    const ElfW(Sym) *sa = *(const ElfW(Sym) **)a, *sb = *(const ElfW(Sym) **)b;
+
+    if (sa->st_size != sb->st_size)
+        return sa->st_size < sb->st_size ? 1 : -1;
+    return sa->st_value < sb->st_value ? -1 : sa->st_value > sb->st_value;
+}
+
+/* -Wl,--print-function-sizes: the code size of every function that made
+   it into the output, largest first */
+static void print_function_sizes(TCCState *s1)
+{
+    ElfW(Sym) *sym, **tab;
+    int i, n;
+    unsigned long total;
+
+    tab = tcc_malloc(symtab_section->data_offset / sizeof(ElfW(Sym)) * sizeof(*tab));
+    n = 0;
+    for_each_elem(symtab_section, 1, sym, ElfW(Sym)) {
+        if (ELFW(ST_TYPE)(sym->st_info) == STT_FUNC
+            && sym->st_shndx != SHN_UNDEF && sym->st_shndx < SHN_LORESERVE
+            && (s1->sections[sym->st_shndx]->sh_flags & SHF_ALLOC))
+            tab[n++] = sym;
+    }
+    qsort(tab, n, sizeof(*tab), cmp_func_size);
+    total = 0;
+    fprintf(stderr, "%8s %10s  %s\n", "size", "address", "function");
+    for (i = 0; i < n; i++) {
+        sym = tab[i];
+        fprintf(stderr, "%8lu %10lx  %s\n", (unsigned long)sym->st_size,
+                (unsigned long)sym->st_value,
+                (char *)symtab_section->link->data + sym->st_name);
+        total += sym->st_size;
+    }
+    fprintf(stderr, "%8lu %10s  total in %d functions\n", total, "", n);
+    tcc_free(tab);
+}
+
 static void tcc_output_binary(TCCState *s1, FILE *f,
                               const int *sec_order)
 {
@@ -2077,6 +2278,9 @@ static int elf_output_file(TCCState *s1, const char *filename)
     if (file_type != TCC_OUTPUT_OBJ) {
         /* if linking, also link in runtime libraries (libc, libgcc, etc.) */
         tcc_add_runtime(s1);
+        if (s1->gc_sections && file_type == TCC_OUTPUT_EXE)
+            gc_sections(s1);
+        merge_split_sections(s1);
 	resolve_common_syms(s1);
 
         if (!s1->static_link) {
@@ -2212,6 +2416,8 @@ static int elf_output_file(TCCState *s1, const char *filename)
         ret = final_sections_reloc(s1);
         if (ret)
             goto the_end;
+        if (s1->print_func_sizes)
+            print_function_sizes(s1);
 	tidy_section_headers(s1, sec_order);
 
         /* Perform relocation to GOT or PLT entries */
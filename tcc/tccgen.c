@@ -31,8 +31,6 @@
 ST_DATA int rsym, anon_sym, ind, loc;
 
 ST_DATA Sym *sym_free_first;
-ST_DATA void **sym_pools;
-ST_DATA int nb_sym_pools;
 
 ST_DATA Sym *global_stack;
 ST_DATA Sym *local_stack;
@@ -71,6 +69,13 @@ ST_DATA struct switch_t {
     int def_sym; /* default symbol */
 } *cur_switch; /* current switch */
 
+static struct inline_ret {
+    int jsym; /* jumps to the end of the expansion */
+    int loc; /* where 'return' stores the value */
+    int scope; /* local_scope of the outer block of the body */
+} *inline_ret; /* set while a -finline-functions body is expanded */
+static int inline_depth;
+
 /* ------------------------------------------------------------------------- */
 
 static void gen_cast(CType *type);
@@ -96,6 +101,8 @@ static void vpush64(int ty, unsigned long long v);
 static void vpush(CType *type);
 static int gvtst(int inv, int t);
 static void gen_inline_functions(TCCState *s);
+static LeafFunc *leaf_find(Sym *sym, Sym *f);
+static void inline_call(LeafFunc *fn);
 static void skip_or_save_block(TokenString **str);
 static void gv_dup(void);
 
@@ -458,8 +465,7 @@ static Sym *__sym_malloc(void)
     Sym *sym_pool, *sym, *last_sym;
     int i;
 
-    sym_pool = tcc_malloc(SYM_POOL_NB * sizeof(Sym));
-    dynarray_add(&sym_pools, &nb_sym_pools, sym_pool);
+    sym_pool = tcc_arena_alloc(tcc_state, SYM_POOL_NB * sizeof(Sym));
 
     last_sym = sym_free_first;
     sym = sym_pool;
@@ -1483,6 +1489,165 @@ static int reg_fret(int t)
     return REG_FRET;
 }
 
+#ifdef TCC_TARGET_I386
+# define SOFT_FLOAT(t) (tcc_state->soft_float && is_float(t))
+#else
+# define SOFT_FLOAT(t) 0
+#endif
+
+/* -msoft-float: float and double values never live in registers. They
+   are constants, lvalues or stack temporaries, and every operation on
+   them is a call to the soft-float runtime, which gets and returns the
+   bit patterns as int / long long. */
+
+/* view the float value 'sv' as the unsigned integer of the same size */
+static void sf_bitcast(SValue *sv)
+{
+    int bt;
+    uint32_t f;
+    uint64_t d;
+
+    bt = sv->type.t & VT_BTYPE;
+    if (bt == VT_LDOUBLE)
+        tcc_error("long double is not supported with -msoft-float");
+    if ((sv->r & (VT_VALMASK | VT_LVAL | VT_SYM)) == VT_CONST) {
+        if (bt == VT_FLOAT) {
+            memcpy(&f, &sv->c.f, sizeof f);
+            sv->c.i = f;
+        } else {
+            memcpy(&d, &sv->c.d, sizeof d);
+            sv->c.i = d;
+        }
+    }
+    sv->type.t = (sv->type.t & ~VT_BTYPE) | VT_UNSIGNED |
+        (bt == VT_FLOAT ? VT_INT : VT_LLONG);
+}
+
+/* vtop is the bit pattern of a float of type 't' in registers: move it
+   to a new stack temporary, which becomes vtop */
+static void sf_spill(int t)
+{
+    CType type;
+    int size, align, addr;
+
+    type.t = t & VT_BTYPE;
+    type.ref = NULL;
+    size = type_size(&type, &align);
+    loc = (loc - size) & -align;
+    addr = loc;
+    vtop->type.t = VT_UNSIGNED | (type.t == VT_FLOAT ? VT_INT : VT_LLONG);
+    vset(&type, VT_LOCAL | VT_LVAL, addr);
+    sf_bitcast(vtop);
+    vswap();
+    vstore();
+    vpop();
+    vset(&type, VT_LOCAL | VT_LVAL, addr);
+}
+
+#ifdef TCC_TARGET_I386
+/* call runtime routine 'func' on the 'nargs' values on top of the stack
+   (already bitcast); the result of type 't' replaces them */
+static void sf_call(int func, int nargs, int t)
+{
+    vpush_global_sym(&func_old_type, func);
+    vrott(nargs + 1);
+    gfunc_call(nargs);
+    vpushi(0);
+    vtop->r = REG_IRET;
+    if ((t & VT_BTYPE) == VT_DOUBLE || (t & VT_BTYPE) == VT_LLONG)
+        vtop->r2 = REG_LRET;
+    if (is_float(t)) {
+        sf_spill(t);
+    } else {
+        vtop->type.t = t;
+    }
+}
+
+/* soft-float version of gen_opf() */
+static void gen_opsf(int op)
+{
+    int d, func;
+
+    d = (vtop->type.t & VT_BTYPE) == VT_DOUBLE;
+    switch(op) {
+    case '+': func = d ? TOK___adddf3 : TOK___addsf3; break;
+    case '-': func = d ? TOK___subdf3 : TOK___subsf3; break;
+    case '*': func = d ? TOK___muldf3 : TOK___mulsf3; break;
+    case '/': func = d ? TOK___divdf3 : TOK___divsf3; break;
+    case TOK_EQ: func = d ? TOK___eqdf2 : TOK___eqsf2; break;
+    case TOK_NE: func = d ? TOK___nedf2 : TOK___nesf2; break;
+    case TOK_LT: case TOK_ULT: func = d ? TOK___ltdf2 : TOK___ltsf2; op = TOK_LT; break;
+    case TOK_LE: case TOK_ULE: func = d ? TOK___ledf2 : TOK___lesf2; op = TOK_LE; break;
+    case TOK_GT: case TOK_UGT: func = d ? TOK___gtdf2 : TOK___gtsf2; op = TOK_GT; break;
+    case TOK_GE: case TOK_UGE: func = d ? TOK___gedf2 : TOK___gesf2; op = TOK_GE; break;
+    default:
+        tcc_error("invalid operands for binary operation");
+        return;
+    }
+    sf_bitcast(vtop - 1);
+    sf_bitcast(vtop);
+    if (op >= TOK_ULT && op <= TOK_GT) {
+        /* the comparison routines return an int to compare with 0 the
+           same way; unordered operands make the test fail */
+        sf_call(func, 2, VT_INT);
+        vpushi(0);
+        gen_op(op);
+    } else {
+        sf_call(func, 2, d ? VT_DOUBLE : VT_FLOAT);
+    }
+}
+
+/* negation only flips the sign bit */
+static void gen_negsf(void)
+{
+    int t = vtop->type.t & VT_BTYPE;
+
+    sf_bitcast(vtop);
+    if (t == VT_FLOAT)
+        vpushi(0x80000000);
+    else
+        vpushll(0x8000000000000000ULL);
+    gen_op('^');
+    sf_spill(t);
+}
+
+/* soft-float conversion of vtop to 'dbt' where the source, the
+   destination or both are floats (char/short/bool are left to gen_cast) */
+static void gen_cvt_sf(int dbt)
+{
+    int sbt, sd, dd, func;
+
+    sbt = vtop->type.t & (VT_BTYPE | VT_UNSIGNED);
+    if ((dbt & VT_BTYPE) == VT_LDOUBLE)
+        tcc_error("long double is not supported with -msoft-float");
+    sd = (sbt & VT_BTYPE) == VT_DOUBLE;
+    dd = (dbt & VT_BTYPE) == VT_DOUBLE;
+    if (is_float(sbt) && is_float(dbt)) {
+        func = dd ? TOK___extendsfdf2 : TOK___truncdfsf2;
+    } else if (is_float(dbt)) {
+        if (sbt == (VT_LLONG | VT_UNSIGNED))
+            func = dd ? TOK___floatundidf : TOK___floatundisf;
+        else if ((sbt & VT_BTYPE) == VT_LLONG)
+            func = dd ? TOK___floatdidf : TOK___floatdisf;
+        else if (sbt == (VT_INT | VT_UNSIGNED))
+            func = dd ? TOK___floatunsidf : TOK___floatunsisf;
+        else
+            func = dd ? TOK___floatsidf : TOK___floatsisf;
+    } else if (dbt == (VT_LLONG | VT_UNSIGNED)) {
+        func = sd ? TOK___fixunsdfdi : TOK___fixunssfdi;
+    } else if ((dbt & VT_BTYPE) == VT_LLONG) {
+        func = sd ? TOK___fixdfdi : TOK___fixsfdi;
+    } else if (dbt == (VT_INT | VT_UNSIGNED)) {
+        func = sd ? TOK___fixunsdfsi : TOK___fixunssfsi;
+    } else {
+        func = sd ? TOK___fixdfsi : TOK___fixsfsi;
+    }
+    if (is_float(sbt))
+        sf_bitcast(vtop);
+    sf_call(func, 1, dbt);
+}
+#endif
+
 #if PTR_SIZE == 4
 /* expand 64bit on stack in two ints */
 static void lexpand(void)
@@ -1553,6 +1718,14 @@ static void gv_dup(void)
     SValue sv;
 
     t = vtop->type.t;
+    if (SOFT_FLOAT(t)) {
+        /* copy to a temporary which later stores do not change */
+        sf_bitcast(vtop);
+        gv(RC_INT);
+        sf_spill(t);
+        vdup();
+        return;
+    }
 #if PTR_SIZE == 4
     if ((t & VT_BTYPE) == VT_LLONG) {
         if (t & VT_BITFIELD) {
@@ -2070,6 +2243,11 @@ static void gen_opif(int op)
         vtop--;
     } else {
     general_case:
+#ifdef TCC_TARGET_I386
+        if (tcc_state->soft_float)
+            gen_opsf(op);
+        else
+#endif
         gen_opf(op);
     }
 }
@@ -2350,7 +2528,8 @@ redo:
         }
     }
     // Make sure that we have converted to an rvalue:
-    if (vtop->r & VT_LVAL)
+    // (soft-float results are stack temporaries and stay there)
+    if ((vtop->r & VT_LVAL) && !SOFT_FLOAT(vtop->type.t))
         gv(is_float(vtop->type.t & VT_BTYPE) ? RC_FLOAT : RC_INT);
 }
 
@@ -2550,6 +2729,19 @@ static void gen_cast(CType *type)
             vtop->c.i = 1;
         } else {
             /* non constant case: generate code */
+#ifdef TCC_TARGET_I386
+            if ((sf || df) && dbt != VT_BOOL && tcc_state->soft_float) {
+                /* char/short destinations are narrowed from int */
+                if (sf && !df && dbt != (VT_INT | VT_UNSIGNED) &&
+                    (dbt & VT_BTYPE) != VT_LLONG) {
+                    gen_cvt_sf(VT_INT);
+                    if ((type->t & (VT_BTYPE | VT_UNSIGNED)) != VT_INT)
+                        gen_cast(type);
+                } else {
+                    gen_cvt_sf(dbt);
+                }
+            } else
+#endif
             if (sf && df) {
                 /* convert from fp to fp */
                 gen_cvt_ftof(dbt);
@@ -3068,7 +3260,7 @@ static void gen_assign_cast(CType *dt)
 /* store vtop in lvalue pushed on stack */
 ST_FUNC void vstore(void)
 {
-    int sbt, dbt, ft, r, t, size, align, bit_size, bit_pos, rc, delayed_cast;
+    int sbt, dbt, ft, r, t, size, align, bit_size, bit_pos, rc, delayed_cast, sf;
 
     ft = vtop[-1].type.t;
     sbt = vtop->type.t & VT_BTYPE;
@@ -3181,7 +3373,13 @@ ST_FUNC void vstore(void)
             }
 #endif
             rc = RC_INT;
-            if (is_float(ft)) {
+            sf = SOFT_FLOAT(ft) ? ft : 0;
+            if (sf) {
+                /* soft-float: store the bits with integer moves */
+                sf_bitcast(vtop - 1);
+                sf_bitcast(vtop);
+                ft = vtop[-1].type.t;
+            } else if (is_float(ft)) {
                 rc = RC_FLOAT;
 #ifdef TCC_TARGET_X86_64
                 if ((ft & VT_BTYPE) == VT_LDOUBLE) {
@@ -3234,6 +3432,8 @@ ST_FUNC void vstore(void)
         vswap();
         vtop--; /* NOT vpop() because on x86 it would flush the fp stack */
         vtop->r |= delayed_cast;
+        if (sf)
+            sf_spill(sf);
     }
 }
 
@@ -4531,6 +4731,9 @@ static void gfunc_param_typed(Sym *func, Sym *arg)
         type.t &= ~VT_CONSTANT; /* need to do that to avoid false warning */
         gen_assign_cast(&type);
     }
+    /* soft-float arguments are passed as their bits */
+    if (SOFT_FLOAT(vtop->type.t))
+        sf_bitcast(vtop);
 }
 
 /* parse an expression and return its type without any side effect. */
@@ -4950,6 +5153,13 @@ ST_FUNC void unary(void)
         next();
         unary();
         t = vtop->type.t & VT_BTYPE;
+#ifdef TCC_TARGET_I386
+        if (SOFT_FLOAT(t) &&
+            (vtop->r & (VT_VALMASK | VT_LVAL | VT_SYM)) != VT_CONST) {
+            gen_negsf();
+            break;
+        }
+#endif
 	if (is_float(t)) {
             /* In IEEE negate(x) isn't subtract(0,x), but rather
 	       subtract(-0, x).  */
@@ -5157,8 +5367,18 @@ ST_FUNC void unary(void)
         } else if (tok == '(') {
             SValue ret;
             Sym *sa;
+            LeafFunc *fn;
             int nb_args, ret_nregs, ret_align, regsize, variadic;
 
+            /* direct call of a function that -finline-functions keeps */
+            if (tcc_state->inline_functions && !nocode_wanted && !const_wanted
+                && (vtop->type.t & VT_BTYPE) == VT_FUNC
+                && (vtop->r & (VT_VALMASK | VT_SYM)) == (VT_CONST | VT_SYM)
+                && vtop->c.i == 0
+                && (fn = leaf_find(vtop->sym, vtop->type.ref)) != NULL) {
+                inline_call(fn);
+                continue;
+            }
             /* function call  */
             if ((vtop->type.t & VT_BTYPE) != VT_FUNC) {
                 /* pointer test (no array accepted) */
@@ -5212,7 +5432,13 @@ ST_FUNC void unary(void)
 
             if (ret_nregs) {
                 /* return in register */
-                if (is_float(ret.type.t)) {
+                if (SOFT_FLOAT(ret.type.t)) {
+                    /* the bits come back in eax (and edx) */
+                    ret.r = REG_IRET;
+                    if ((ret.type.t & VT_BTYPE) == VT_DOUBLE)
+                        ret.r2 = REG_LRET;
+                    sf_bitcast(&ret);
+                } else if (is_float(ret.type.t)) {
                     ret.r = reg_fret(ret.type.t);
 #ifdef TCC_TARGET_X86_64
                     if ((ret.type.t & VT_BTYPE) == VT_QFLOAT)
@@ -5253,6 +5479,8 @@ ST_FUNC void unary(void)
                 vsetc(&ret.type, r, &ret.c);
                 vtop->r2 = ret.r2; /* Loop only happens when r2 is VT_CONST */
             }
+            if (ret_nregs && SOFT_FLOAT(s->type.t))
+                sf_spill(s->type.t);
 
             /* handle packed struct return */
             if (((s->type.t & VT_BTYPE) == VT_STRUCT) && ret_nregs) {
@@ -5479,7 +5707,7 @@ static int condition_3way(void)
 
 static void expr_cond(void)
 {
-    int tt, u, r1, r2, rc, t1, t2, bt1, bt2, islv, c, g;
+    int tt, u, r1, r2, rc, t1, t2, bt1, bt2, islv, c, g, sf;
     SValue sv;
     CType type, type1, type2;
 
@@ -5500,7 +5728,9 @@ static void expr_cond(void)
 #endif
             } else
                 rc = RC_INT;
-            gv(rc);
+            /* a soft-float condition stays in memory */
+            if (!SOFT_FLOAT(vtop->type.t))
+                gv(rc);
             save_regs(1);
             if (g)
                 gv_dup();
@@ -5596,10 +5826,14 @@ static void expr_cond(void)
                that `(expr ? a : b).mem` does not error  with "lvalue expected" */
             islv = (vtop->r & VT_LVAL) && (sv.r & VT_LVAL) && VT_STRUCT == (type.t & VT_BTYPE);
             islv &= c < 0;
+            /* soft-float: both branches leave the bits in eax (and edx) */
+            sf = c < 0 && SOFT_FLOAT(type.t) ? type.t : 0;
 
             /* now we convert second operand */
             if (c != 1) {
                 gen_cast(&type);
+                if (sf)
+                    sf_bitcast(vtop);
                 if (islv) {
                     mk_pointer(&vtop->type);
                     gaddrof();
@@ -5608,7 +5842,9 @@ static void expr_cond(void)
             }
 
             rc = RC_INT;
-            if (is_float(type.t)) {
+            if (sf) {
+                rc = RC_IRET;
+            } else if (is_float(type.t)) {
                 rc = RC_FLOAT;
 #ifdef TCC_TARGET_X86_64
                 if ((type.t & VT_BTYPE) == VT_LDOUBLE) {
@@ -5633,6 +5869,8 @@ static void expr_cond(void)
             if (c != 0) {
                 *vtop = sv;
                 gen_cast(&type);
+                if (sf)
+                    sf_bitcast(vtop);
                 if (islv) {
                     mk_pointer(&vtop->type);
                     gaddrof();
@@ -5642,11 +5880,13 @@ static void expr_cond(void)
 
             if (c < 0) {
                 r1 = gv(rc);
-                move_reg(r2, r1, type.t);
+                move_reg(r2, r1, sf ? vtop->type.t : type.t);
                 vtop->r = r2;
                 gsym(tt);
                 if (islv)
                     indir();
+                if (sf)
+                    sf_spill(sf);
             }
         }
     }
@@ -5797,6 +6037,10 @@ static void gfunc_return(CType *func_type)
                 }
             }
         }
+    } else if (SOFT_FLOAT(func_type->t)) {
+        /* soft-float: the bits go back in eax (and edx) */
+        sf_bitcast(vtop);
+        gv(RC_IRET);
     } else if (is_float(func_type->t)) {
         gv(rc_fret(func_type->t));
     } else {
@@ -6000,15 +6244,25 @@ static void block(int *bsym, int *csym, int is_expr)
         if (tok != ';') {
             gexpr();
             gen_assign_cast(&func_vt);
-            if ((func_vt.t & VT_BTYPE) == VT_VOID)
+            if ((func_vt.t & VT_BTYPE) == VT_VOID) {
                 vtop--;
-            else
+            } else if (inline_ret) {
+                vset(&func_vt, VT_LOCAL | lvalue_type(func_vt.t), inline_ret->loc);
+                vswap();
+                vstore();
+                vpop();
+            } else {
                 gfunc_return(&func_vt);
+            }
         }
         skip(';');
         /* jump unless last stmt in top-level block */
-        if (tok != '}' || local_scope != 1)
+        if (inline_ret) {
+            if (tok != '}' || local_scope != inline_ret->scope)
+                inline_ret->jsym = gjmp(inline_ret->jsym);
+        } else if (tok != '}' || local_scope != 1) {
             rsym = gjmp(rsym);
+        }
 	nocode_wanted |= 0x20000000;
     } else if (tok == TOK_BREAK) {
         /* compute jump */
@@ -6808,6 +7062,36 @@ static void decl_initializer(CType *type, Section *sec, unsigned long c,
     }
 }
 
+/* -ffunction-sections/-fdata-sections: the section '<sec>.<name>' with
+   the type and flags of 'sec', so that the linker can drop it alone */
+static Section *split_section(Section *sec, int v)
+{
+    TCCState *s1 = tcc_state;
+    char buf[256];
+    Section *s;
+    int i;
+
+    snprintf(buf, sizeof buf, "%s.%s", sec->name, get_tok_str(v, NULL));
+    for (i = 1; i < s1->nb_sections; i++) {
+        s = s1->sections[i];
+        if (!strcmp(buf, s->name))
+            return s;
+    }
+    s = new_section(s1, buf, sec->sh_type, sec->sh_flags);
+    s->sh_addralign = 1;
+    return s;
+}
+
+/* section for the code of function 'sym' */
+static Section *func_section(Sym *sym, Section *sec)
+{
+    if (sec)
+        return sec;
+    if (tcc_state->function_sections)
+        return split_section(text_section, sym->v);
+    return text_section;
+}
+
 /* parse an initializer for type 't' if 'has_init' is non zero, and
    allocate space in local or global data space ('r' is either
    VT_LOCAL or VT_CONST). If 'v' is non zero, then an associated
@@ -6956,6 +7240,8 @@ static void decl_initializer_alloc(CType *type, AttributeDef *ad, int r,
                 sec = data_section;
             else if (tcc_state->nocommon)
                 sec = bss_section;
+            if (sec && v && tcc_state->data_sections)
+                sec = split_section(sec, v);
         }
 
         if (sec) {
@@ -7116,7 +7402,7 @@ static void gen_inline_functions(TCCState *s)
 
                 begin_macro(fn->func_str, 1);
                 next();
-                cur_text_section = text_section;
+                cur_text_section = func_section(sym, NULL);
                 gen_function(sym);
                 end_macro();
 
@@ -7137,6 +7423,328 @@ ST_FUNC void free_inline_functions(TCCState *s)
             tok_str_free(fn->func_str);
     }
     dynarray_reset(&s->inline_fns, &s->nb_inline_fns);
+    free_leaf_functions(s, 0);
+}
+
+/* drop the -finline-functions bodies of the finished unit, except those
+   that are valid in any unit ('all' drops these too) */
+ST_FUNC void free_leaf_functions(TCCState *s, int all)
+{
+    int i, n;
+
+    for (i = n = 0; i < s->nb_leaf_fns; ++i) {
+        LeafFunc *fn = s->leaf_fns[i];
+        if (fn->global && !all) {
+            fn->sym = NULL;
+            s->leaf_fns[n++] = fn;
+        } else {
+            tok_str_free(fn->func_str);
+            tcc_free(fn);
+        }
+    }
+    s->nb_leaf_fns = n;
+    if (!n) {
+        tcc_free(s->leaf_fns);
+        s->leaf_fns = NULL;
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+/* -finline-functions: small leaf functions are kept as token strings and
+   parsed again at each call site, with the arguments bound to the
+   parameters. Constant arguments become constant parameters, which lets
+   the usual constant folding see through the call. */
+
+#define LEAF_MAX_TOKENS 96 /* bigger bodies are always called */
+#define LEAF_MAX_DEPTH 4 /* expansions inside expansions */
+
+static int leaf_param(Sym *f, int v)
+{
+    Sym *p;
+    int i;
+
+    for (p = f->next, i = 0; p; p = p->next, i++)
+        if ((p->v & ~SYM_FIELD) == v)
+            return i;
+    return -1;
+}
+
+static int leaf_arith_type(CType *type)
+{
+    int bt = type->t & VT_BTYPE;
+    return is_integer_btype(bt) || bt == VT_BOOL || is_float(bt);
+}
+
+/* record 'sym' for expansion if its body 'str' is small and calls
+   nothing but functions recorded before. Returns non-zero if 'str' is
+   kept. Must be called with the current token saved by unget_tok(). */
+static int leaf_register(Sym *sym, TokenString *str)
+{
+    Sym *f = sym->type.ref, *p, *s;
+    LeafFunc *fn;
+    int t, t1, t2, i, n, depth, max_depth, semis, second;
+    int ok, pure, global, assigned, nb_names, names[LEAF_MAX_NAMES];
+
+    if (f->f.func_type != FUNC_NEW || (f->type.t & VT_BTYPE) == VT_STRUCT)
+        return 0;
+    global = !(sym->type.t & VT_STATIC)
+        && ((f->type.t & VT_BTYPE) == VT_VOID || leaf_arith_type(&f->type));
+    for (p = f->next, n = 0; p; p = p->next, n++) {
+        if (n == LEAF_MAX_PARAMS || (p->type.t & VT_BTYPE) == VT_STRUCT)
+            return 0;
+        if (!leaf_arith_type(&p->type))
+            global = 0;
+    }
+
+    ok = pure = 1;
+    assigned = 0;
+    t1 = t2 = n = depth = max_depth = semis = second = nb_names = 0;
+    begin_macro(str, 2);
+    next();
+    while (ok && tok != TOK_EOF) {
+        t = tok;
+        if (++n > LEAF_MAX_TOKENS)
+            ok = 0;
+        if (n == 2)
+            second = t;
+        switch (t) {
+        case TOK_GOTO: case TOK_STATIC: case TOK_LABEL:
+        case TOK_ASM1: case TOK_ASM2: case TOK_ASM3:
+            ok = 0;
+            break;
+        case '{':
+            if (++depth > max_depth)
+                max_depth = depth;
+            break;
+        case '}':
+            depth--;
+            break;
+        case ';':
+            semis++;
+            break;
+        case ':':
+            /* a label would be defined once per expansion */
+            if (t1 >= TOK_UIDENT && (t2 == '{' || t2 == '}' || t2 == ';'))
+                ok = 0;
+            break;
+        case '(':
+            /* calls are only allowed to functions expanded themselves */
+            if (t1 >= TOK_UIDENT && leaf_param(f, t1) < 0) {
+                s = sym_find(t1);
+                if (!s || (s->type.t & VT_BTYPE) != VT_FUNC || !leaf_find(s, s->type.ref))
+                    ok = 0;
+            }
+            break;
+        case '=': case TOK_A_XOR: case TOK_A_OR: case TOK_A_SHL: case TOK_A_SAR:
+        case TOK_INC: case TOK_DEC:
+            pure = 0;
+            if (t1 >= TOK_UIDENT && (i = leaf_param(f, t1)) >= 0)
+                assigned |= 1 << i;
+            break;
+        default:
+            if (t >= TOK_A_MOD && t <= TOK_A_DIV) {
+                pure = 0;
+                if (t1 >= TOK_UIDENT && (i = leaf_param(f, t1)) >= 0)
+                    assigned |= 1 << i;
+            } else if (t >= TOK_UIDENT) {
+                i = leaf_param(f, t);
+                if (i < 0) {
+                    global = 0;
+                    if (t1 != '.' && t1 != TOK_ARROW) {
+                        for (i = 0; i < nb_names && names[i] != t; i++)
+                            ;
+                        if (i == LEAF_MAX_NAMES)
+                            ok = 0;
+                        else if (i == nb_names)
+                            names[nb_names++] = t;
+                    }
+                } else if (t1 == TOK_INC || t1 == TOK_DEC || t1 == '&')
+                    assigned |= 1 << i;
+            }
+            break;
+        }
+        t2 = t1;
+        t1 = t;
+        next();
+    }
+    end_macro();
+    if (!ok)
+        return 0;
+
+    fn = tcc_mallocz(sizeof *fn);
+    fn->sym = sym;
+    fn->v = sym->v;
+    fn->func_str = str;
+    fn->type = f->type;
+    for (p = f->next; p; p = p->next) {
+        fn->param_v[fn->nb_params] = p->v & ~SYM_FIELD;
+        fn->param[fn->nb_params++] = p->type;
+    }
+    fn->nb_names = nb_names;
+    memcpy(fn->names, names, nb_names * sizeof *names);
+    fn->assigned = assigned;
+    fn->is_expr = second == TOK_RETURN && semis == 1 && max_depth == 1
+        && (f->type.t & VT_BTYPE) != VT_VOID;
+    fn->pure = pure;
+    fn->global = global;
+    dynarray_add(&tcc_state->leaf_fns, &tcc_state->nb_leaf_fns, fn);
+    return 1;
+}
+
+/* the recorded body for a call of 'sym' whose type is 'f'. A function
+   defined in an earlier unit qualifies if its body uses nothing but its
+   parameters and the prototype here agrees */
+static LeafFunc *leaf_find(Sym *sym, Sym *f)
+{
+    TCCState *s1 = tcc_state;
+    LeafFunc *fn;
+    Sym *p;
+    int i, j;
+
+    if (inline_depth >= LEAF_MAX_DEPTH)
+        return NULL;
+    for (i = s1->nb_leaf_fns; i-- > 0;) {
+        fn = s1->leaf_fns[i];
+        if (fn->sym != sym)
+            continue;
+        /* the body is parsed again in the caller's scope: a local
+           there must not hide what its names meant at the definition */
+        for (j = 0; j < fn->nb_names; j++) {
+            p = sym_find(fn->names[j]);
+            if (p && p->sym_scope)
+                return NULL;
+        }
+        return fn;
+    }
+    if ((sym->type.t & VT_STATIC) || f->f.func_type != FUNC_NEW
+        || (sym->c && elfsym(sym)->st_shndx != SHN_UNDEF))
+        return NULL;
+    for (i = s1->nb_leaf_fns; i-- > 0;) {
+        fn = s1->leaf_fns[i];
+        if (fn->sym || fn->v != sym->v
+            || ((fn->type.t ^ f->type.t) & (VT_BTYPE | VT_UNSIGNED)))
+            continue;
+        for (p = f->next, j = 0; p && j < fn->nb_params; p = p->next, j++)
+            if ((fn->param[j].t ^ p->type.t) & (VT_BTYPE | VT_UNSIGNED))
+                break;
+        if (!p && j == fn->nb_params)
+            return fn;
+    }
+    return NULL;
+}
+
+/* expand the call of 'fn' (on vtop, the current token is its '('). The
+   arguments go to new locals, except constants for parameters the body
+   does not write, and plain locals when the body writes nothing at all
+   and does not take the parameter's address either, which are bound
+   directly. 'return' stores the value and jumps to the
+   end of the body; a body of the form '{ return expr; }' leaves the value
+   on the stack instead, so that it can fold. */
+static void inline_call(LeafFunc *fn)
+{
+    struct inline_ret ret, *saved_ret;
+    CType type, saved_vt;
+    const char *saved_funcname;
+    int saved_nocode_wanted, i, size, align;
+    int r[LEAF_MAX_PARAMS], c[LEAF_MAX_PARAMS];
+    Sym *s;
+
+    vpop();
+    next();
+    for (i = 0; i < fn->nb_params; i++) {
+        if (i)
+            skip(',');
+        if (tok == ')')
+            tcc_error("too few arguments to function");
+        expr_eq();
+        type = fn->param[i];
+        type.t &= ~VT_CONSTANT;
+        if (fn->pure && !(fn->assigned & (1 << i))
+            && (vtop->r & (VT_VALMASK | VT_LVAL | VT_SYM)) == (VT_LOCAL | VT_LVAL)
+            && !(vtop->type.t & (VT_BITFIELD | VT_VOLATILE))
+            && is_compatible_unqualified_types(&vtop->type, &type)) {
+            r[i] = vtop->r;
+            c[i] = vtop->c.i;
+        } else {
+            gen_assign_cast(&type);
+            if (!(fn->assigned & (1 << i)) && !is_float(type.t)
+                && (vtop->r & (VT_VALMASK | VT_LVAL | VT_SYM)) == VT_CONST
+                && (vtop->c.i == (int)vtop->c.i || type_size(&type, &align) <= 4)) {
+                r[i] = VT_CONST;
+                c[i] = vtop->c.i;
+            } else {
+                size = type_size(&type, &align);
+                loc = (loc - size) & -align;
+                r[i] = VT_LOCAL | lvalue_type(type.t);
+                c[i] = loc;
+                vset(&type, r[i], c[i]);
+                vswap();
+                vstore();
+            }
+        }
+        vpop();
+    }
+    if (tok != ')')
+        tcc_error("too many arguments to function");
+    skip(')');
+
+    s = local_stack;
+    ++local_scope;
+    for (i = 0; i < fn->nb_params; i++)
+        sym_push(fn->param_v[i], &fn->param[i], r[i], c[i]);
+
+    saved_ret = inline_ret;
+    saved_vt = func_vt;
+    saved_funcname = funcname;
+    saved_nocode_wanted = nocode_wanted;
+    func_vt = fn->type;
+    funcname = get_tok_str(fn->v, NULL);
+    inline_depth++;
+    unget_tok(0);
+    begin_macro(fn->func_str, 2);
+    next();
+    if (fn->is_expr) {
+        skip('{');
+        skip(TOK_RETURN);
+        gexpr();
+        gen_assign_cast(&func_vt);
+        /* read up to the '}' so that the body is again on top of the
+           macro stack, whatever nested expansions pushed */
+        skip(';');
+    } else {
+        ret.jsym = 0;
+        ret.scope = local_scope + 1;
+        if ((func_vt.t & VT_BTYPE) != VT_VOID) {
+            size = type_size(&func_vt, &align);
+            loc = (loc - size) & -align;
+            ret.loc = loc;
+        }
+        inline_ret = &ret;
+        save_regs(0);
+        block(NULL, NULL, 0);
+        gsym(ret.jsym);
+        nocode_wanted = saved_nocode_wanted;
+        if ((func_vt.t & VT_BTYPE) != VT_VOID) {
+            vset(&func_vt, VT_LOCAL | lvalue_type(func_vt.t), ret.loc);
+        } else {
+            vpushi(0);
+            vtop->type.t = VT_VOID;
+        }
+    }
+    end_macro();
+    inline_depth--;
+    inline_ret = saved_ret;
+    func_vt = saved_vt;
+    funcname = saved_funcname;
+
+    /* the result is an rvalue, not one of the parameters */
+    if ((vtop->r & VT_LVAL) && !SOFT_FLOAT(vtop->type.t))
+        gv(is_float(vtop->type.t) ? RC_FLOAT : RC_INT);
+    if (!(vtop->r & VT_SYM))
+        vtop->sym = NULL;
+    sym_pop(&local_stack, s, 1);
+    --local_scope;
+    next();
 }
 
 /* 'l' is VT_LOCAL or VT_CONST to define default storage type, or VT_CMP
@@ -7276,11 +7884,34 @@ static int decl0(int l, int is_for_loop_init, Sym *func_sym)
 		    skip_or_save_block(&fn->func_str);
                     dynarray_add(&tcc_state->inline_fns,
 				 &tcc_state->nb_inline_fns, fn);
+                    if (tcc_state->inline_functions) {
+                        TokenString *str = tok_str_alloc();
+                        str->str = tok_str_dup(fn->func_str);
+                        str->len = str->allocated_len = fn->func_str->len;
+                        unget_tok(0);
+                        if (!leaf_register(sym, str))
+                            tok_str_free(str);
+                        next();
+                    }
+                } else if (tcc_state->inline_functions) {
+                    /* keep the body: it may be expanded at call sites */
+                    TokenString *str;
+                    int kept;
+
+                    skip_or_save_block(&str);
+                    unget_tok(0);
+                    kept = leaf_register(sym, str);
+                    begin_macro(str, 2);
+                    next();
+                    cur_text_section = func_section(sym, ad.section);
+                    gen_function(sym);
+                    end_macro();
+                    if (!kept)
+                        tok_str_free(str);
+                    next();
                 } else {
                     /* compute text section */
-                    cur_text_section = ad.section;
-                    if (!cur_text_section)
-                        cur_text_section = text_section;
+                    cur_text_section = func_section(sym, ad.section);
                     gen_function(sym);
                 }
                 break;
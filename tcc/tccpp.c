@@ -19,6 +19,10 @@
  */
 
 #include "tcc.h"
+#include <sys/stat.h>
+#ifndef _WIN32
+# include <sys/mman.h>
+#endif
 
 /********************************************************/
 /* global variables */
@@ -35,6 +39,8 @@ ST_DATA CString tokcstr; /* current parsed string, if any */
 /* display benchmark infos */
 ST_DATA int total_lines;
 ST_DATA int total_bytes;
+ST_DATA int total_includes; /* #include files opened */
+ST_DATA int total_includes_skipped; /* ... and not opened again */
 ST_DATA int tok_ident;
 ST_DATA TokenSym **table_ident;
 
@@ -1423,9 +1429,11 @@ static void maybe_run_test(TCCState *s)
 }
 
 /* eval an expression for #if/#elif */
-static int expr_preprocess(void)
+/* evaluate the expression after #if. If it is '!defined X', set
+   *guard to X */
+static int expr_preprocess(int *guard)
 {
-    int c, t;
+    int c, t, n = 0, g = 0;
     TokenString *str;
     
     str = tok_str_alloc();
@@ -1442,6 +1450,7 @@ static int expr_preprocess(void)
             if (tcc_state->run_test)
                 maybe_run_test(tcc_state);
             c = define_find(tok) != 0;
+            g = n == 1 && g == '!' ? tok : 0;
             if (t == '(') {
                 next_nomacro();
                 if (tok != ')')
@@ -1453,10 +1462,16 @@ static int expr_preprocess(void)
             /* if undefined macro */
             tok = TOK_CINT;
             tokc.i = 0;
+            g = 0;
+        } else if (tok != TOK_LINEFEED && tok != TOK_EOF) {
+            g = n ? 0 : tok;
         }
+        ++n;
         tok_str_add_tok(str);
     }
     pp_expr = 0;
+    if (g >= TOK_IDENT && guard)
+        *guard = g;
     tok_str_add(str, -1); /* simulate end of file */
     tok_str_add(str, 0);
     /* now evaluate C constant expression */
@@ -1588,7 +1603,7 @@ static CachedInclude *search_cached_include(TCCState *s1, const char *filename,
     if (!add)
         return NULL;
 
-    e = tcc_malloc(sizeof(CachedInclude) + strlen(filename));
+    e = tcc_arena_alloc(s1, sizeof(CachedInclude) + strlen(filename));
     strcpy(e->filename, filename);
     e->ifndef_macro = e->once = 0;
     dynarray_add(&s1->cached_includes, &s1->nb_cached_includes, e);
@@ -1635,6 +1650,10 @@ static void pragma_parse(TCCState *s1)
     } else if (tok == TOK_once) {
         search_cached_include(s1, file->filename, 1)->once = pp_once;
 
+    } else if (s1->emit_pch) {
+        /* the token stream of a precompiled header has no place for them */
+        tcc_error("#pragma %s in a precompiled header", get_tok_str(tok, &tokc));
+
     } else if (s1->output_type == TCC_OUTPUT_PREPROCESS) {
         /* tcc -E: keep pragmas below unchanged */
         unget_tok(' ');
@@ -1839,12 +1858,14 @@ ST_FUNC void preprocess(int is_bof)
 #ifdef INC_DEBUG
                 printf("%s: skipping cached %s\n", file->filename, buf1);
 #endif
+                ++total_includes_skipped;
                 goto include_done;
             }
 
             if (tcc_open(s1, buf1) < 0)
                 continue;
 
+            ++total_includes;
             file->include_next_index = i + 1;
 #ifdef INC_DEBUG
             printf("%s: including %s\n", file->prev->filename, file->filename);
@@ -1868,7 +1889,7 @@ include_done:
         c = 1;
         goto do_ifdef;
     case TOK_IF:
-        c = expr_preprocess();
+        c = expr_preprocess(is_bof ? &file->ifndef_macro : NULL);
         goto do_if;
     case TOK_IFDEF:
         c = 0;
@@ -1907,7 +1928,7 @@ include_done:
         if (c == 1) {
             c = 0;
         } else {
-            c = expr_preprocess();
+            c = expr_preprocess(NULL);
             s1->ifdef_stack_ptr[-1] = c;
         }
     test_else:
@@ -3578,6 +3599,8 @@ ST_INLN void unget_tok(int last_tok)
     tok = last_tok;
 }
 
+static void pch_load(TCCState *s1);
+
 ST_FUNC void preprocess_start(TCCState *s1, int is_asm)
 {
     CString cstr;
@@ -3621,6 +3644,9 @@ ST_FUNC void preprocess_start(TCCState *s1, int is_asm)
 
     parse_flags = is_asm ? PARSE_FLAG_ASM_FILE : 0;
     tok_flags = TOK_FLAG_BOL | TOK_FLAG_BOF;
+
+    if (s1->pch_file && !is_asm && !s1->emit_pch)
+        pch_load(s1);
 }
 
 /* cleanup from error/setjmp */
@@ -3901,3 +3927,301 @@ ST_FUNC int tcc_preprocess(TCCState *s1)
 }
 
 /* ------------------------------------------------------------------------- */
+/* precompiled headers. -emit-pch runs the preprocessor over a header
+   prefix and writes what it leaves behind: the macros it defined, the
+   files it read with their guards, and its declarations as a stream of
+   ready C tokens. -include-pch maps such a file and puts all that in
+   place before the source is read, so the prefix is neither opened nor
+   lexed nor macro-expanded again. The declarations are parsed from the
+   token stream as usual. */
+
+#define PCH_MAGIC 0x48435054 /* "TPCH" */
+static const char pch_id[] = "tcc " TCC_VERSION " " __DATE__ " " __TIME__;
+
+static void pch_put(FILE *f, int v)
+{
+    fwrite(&v, sizeof v, 1, f);
+}
+
+static void pch_put_str(FILE *f, const char *str, int len)
+{
+    int pad = 0;
+    pch_put(f, len);
+    fwrite(str, 1, len, f);
+    fwrite(&pad, 1, -len & (sizeof(int) - 1), f);
+}
+
+static void pch_put_tokens(FILE *f, const int *str)
+{
+    const int *p = str;
+    CValue cv;
+    int t;
+
+    if (p)
+        while (*p)
+            TOK_GET(&t, &p, &cv);
+    pch_put(f, p - str);
+    fwrite(str, sizeof(int), p - str, f);
+}
+
+/* tcc -emit-pch: preprocess the current file and write it to s1->ppfp */
+ST_FUNC void tcc_pch_save(TCCState *s1, Sym *define_start)
+{
+    Sym *s, *a, **macros = NULL;
+    TokenString *decls = tok_str_alloc();
+    CachedInclude *e;
+    FILE *f = s1->ppfp;
+    struct stat st;
+    int i, n, nb_macros = 0;
+
+    /* numbers and strings stay preprocessor tokens, and a space is kept
+       where tcc -E could not tell two words apart without it */
+    parse_flags = PARSE_FLAG_PREPROCESS | PARSE_FLAG_SPACES;
+    for (n = i = 0, next(); tok != TOK_EOF; next()) {
+        if (is_space(tok)) {
+            i = 1;
+            continue;
+        }
+        if (i && n && (tok >= TOK_IDENT || tok == TOK_PPNUM))
+            tok_str_add(decls, ' ');
+        tok_str_add_tok(decls);
+        n = tok >= TOK_IDENT || tok == TOK_PPNUM, i = 0;
+    }
+    tok_str_add(decls, 0);
+    for (s = define_stack; s != define_start; s = s->prev)
+        if (!(s->v & SYM_FIELD) && define_find(s->v) == s
+            && strcmp(get_tok_str(s->v, NULL), "__BASE_FILE__"))
+            dynarray_add(&macros, &nb_macros, s);
+
+    pch_put(f, PCH_MAGIC);
+    pch_put_str(f, pch_id, sizeof pch_id);
+
+    /* token numbers are those of this run, they are mapped by name */
+    pch_put(f, tok_ident - TOK_IDENT);
+    for (i = TOK_IDENT; i < tok_ident; ++i)
+        pch_put_str(f, table_ident[i - TOK_IDENT]->str, table_ident[i - TOK_IDENT]->len);
+
+    pch_put(f, s1->nb_target_deps);
+    for (i = 0; i < s1->nb_target_deps; ++i) {
+        const char *name = s1->target_deps[i];
+        if (stat(name, &st))
+            tcc_error("could not stat '%s'", name);
+        pch_put(f, (int)st.st_mtime);
+        pch_put(f, (int)st.st_size);
+        pch_put_str(f, name, strlen(name));
+    }
+
+    pch_put(f, nb_macros);
+    while (nb_macros) {
+        s = macros[--nb_macros];
+        for (n = 0, a = s->next; a; a = a->next)
+            ++n;
+        pch_put(f, s->v);
+        pch_put(f, s->type.t);
+        pch_put(f, n);
+        for (a = s->next; a; a = a->next) {
+            pch_put(f, a->v & ~SYM_FIELD);
+            pch_put(f, a->type.t);
+        }
+        pch_put_tokens(f, s->d);
+    }
+
+    for (i = n = 0; i < s1->nb_cached_includes; ++i) {
+        e = s1->cached_includes[i];
+        n += define_find(e->ifndef_macro) || e->once == pp_once;
+    }
+    pch_put(f, n);
+    for (i = 0; i < s1->nb_cached_includes; ++i) {
+        e = s1->cached_includes[i];
+        if (define_find(e->ifndef_macro) || e->once == pp_once) {
+            pch_put(f, define_find(e->ifndef_macro) ? e->ifndef_macro : 0);
+            pch_put(f, e->once == pp_once);
+            pch_put_str(f, e->filename, strlen(e->filename));
+        }
+    }
+
+    pch_put_tokens(f, decls->str);
+    tok_str_free(decls);
+    tcc_free(macros);
+}
+
+static const char *pch_name;
+static const int *pch_ptr, *pch_end;
+static int *pch_map, pch_nb_map;
+
+static void pch_need(int n)
+{
+    if (n < 0 || n > pch_end - pch_ptr)
+        tcc_error("precompiled header '%s' is corrupt", pch_name);
+}
+
+static int pch_get(void)
+{
+    pch_need(1);
+    return *pch_ptr++;
+}
+
+static const char *pch_get_str(char *buf, int size)
+{
+    int len = pch_get();
+    const char *str = (const char *)pch_ptr;
+
+    pch_need((len + sizeof(int) - 1) / sizeof(int));
+    pch_ptr += (len + sizeof(int) - 1) / sizeof(int);
+    if (buf) {
+        if (len >= size)
+            pch_need(-1);
+        memcpy(buf, str, len);
+        buf[len] = 0;
+    }
+    return str;
+}
+
+/* token 't' of the run that made the header */
+static int pch_tok(int t)
+{
+    if (t < TOK_IDENT)
+        return t;
+    if (t - TOK_IDENT >= pch_nb_map)
+        pch_need(-1);
+    return pch_map[t - TOK_IDENT];
+}
+
+static void pch_get_tokens(TokenString *ts)
+{
+    const int *p, *end;
+    CValue cv;
+    int t, len = pch_get();
+
+    pch_need(len);
+    p = pch_ptr, end = pch_ptr += len;
+    while (p < end) {
+        TOK_GET(&t, &p, &cv);
+        tok_str_add2(ts, pch_tok(t), &cv);
+    }
+    tok_str_add(ts, 0);
+}
+
+static void *pch_map_file(const char *filename, size_t *psize)
+{
+    void *p = NULL;
+#ifdef _WIN32
+    HANDLE h, m;
+
+    h = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (h == INVALID_HANDLE_VALUE)
+        return NULL;
+    *psize = GetFileSize(h, NULL);
+    m = CreateFileMappingA(h, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (m) {
+        p = MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(m);
+    }
+    CloseHandle(h);
+#else
+    struct stat st;
+    int fd = open(filename, O_RDONLY | O_BINARY);
+
+    if (fd < 0)
+        return NULL;
+    if (0 == fstat(fd, &st) && st.st_size > 0) {
+        *psize = st.st_size;
+        p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED)
+            p = NULL;
+    }
+    close(fd);
+#endif
+    return p;
+}
+
+static void pch_unmap_file(void *p, size_t size)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(p);
+#else
+    munmap(p, size);
+#endif
+}
+
+/* tcc -include-pch */
+static void pch_load(TCCState *s1)
+{
+    char buf[1024];
+    const char *str;
+    void *base;
+    size_t size;
+    struct stat st;
+    TokenString ts, *decls;
+    CachedInclude *e;
+    Sym *first, **ps, *a;
+    int i, j, n, v, t, mtime, fsize;
+
+    pch_name = s1->pch_file;
+    base = pch_map_file(pch_name, &size);
+    if (!base)
+        tcc_error("could not read precompiled header '%s'", pch_name);
+    pch_ptr = base, pch_end = pch_ptr + size / sizeof(int);
+    if (pch_get() != PCH_MAGIC
+        || pch_get() != sizeof pch_id
+        || (--pch_ptr, memcmp(pch_get_str(NULL, 0), pch_id, sizeof pch_id)))
+        tcc_error("'%s' was not made by this tcc", pch_name);
+
+    pch_nb_map = pch_get();
+    pch_need(pch_nb_map);
+    pch_map = tcc_malloc(pch_nb_map * sizeof *pch_map);
+    for (i = 0; i < pch_nb_map; ++i) {
+        n = pch_ptr[0];
+        str = pch_get_str(NULL, 0);
+        pch_map[i] = tok_alloc(str, n)->tok;
+    }
+
+    n = pch_get();
+    for (i = 0; i < n; ++i) {
+        mtime = pch_get();
+        fsize = pch_get();
+        pch_get_str(buf, sizeof buf);
+        if (stat(buf, &st) || (int)st.st_mtime != mtime || (int)st.st_size != fsize)
+            tcc_error("'%s' changed after '%s' was made", buf, pch_name);
+        dynarray_add(&s1->target_deps, &s1->nb_target_deps, tcc_strdup(buf));
+    }
+
+    tok_str_new(&ts);
+    n = pch_get();
+    for (i = 0; i < n; ++i) {
+        v = pch_tok(pch_get());
+        t = pch_get();
+        first = NULL, ps = &first;
+        for (j = pch_get(); j > 0; --j) {
+            int arg = pch_tok(pch_get());
+            a = sym_push2(&define_stack, arg | SYM_FIELD, pch_get(), 0);
+            *ps = a, ps = &a->next;
+        }
+        ts.len = 0;
+        pch_get_tokens(&ts);
+        define_push(v, t, tok_str_dup(&ts), first);
+    }
+    tok_str_free_str(ts.str);
+
+    n = pch_get();
+    for (i = 0; i < n; ++i) {
+        v = pch_tok(pch_get());
+        t = pch_get();
+        pch_get_str(buf, sizeof buf);
+        e = search_cached_include(s1, buf, 1);
+        if (v)
+            e->ifndef_macro = v;
+        if (t)
+            e->once = pp_once;
+    }
+
+    decls = tok_str_alloc();
+    pch_get_tokens(decls);
+    pch_unmap_file(base, size);
+    tcc_free(pch_map);
+    pch_map = NULL;
+    begin_macro(decls, 1);
+}
+
+/* ------------------------------------------------------------------------- */
@@ -245,6 +245,39 @@
      DEF(TOK___fixsfdi, "__fixsfdi")
      DEF(TOK___fixdfdi, "__fixdfdi")
      DEF(TOK___fixxfdi, "__fixxfdi")
+     /* -msoft-float runtime */
+     DEF(TOK___addsf3, "__addsf3")
+     DEF(TOK___adddf3, "__adddf3")
+     DEF(TOK___subsf3, "__subsf3")
+     DEF(TOK___subdf3, "__subdf3")
+     DEF(TOK___mulsf3, "__mulsf3")
+     DEF(TOK___muldf3, "__muldf3")
+     DEF(TOK___divsf3, "__divsf3")
+     DEF(TOK___divdf3, "__divdf3")
+     DEF(TOK___eqsf2, "__eqsf2")
+     DEF(TOK___eqdf2, "__eqdf2")
+     DEF(TOK___nesf2, "__nesf2")
+     DEF(TOK___nedf2, "__nedf2")
+     DEF(TOK___ltsf2, "__ltsf2")
+     DEF(TOK___ltdf2, "__ltdf2")
+     DEF(TOK___lesf2, "__lesf2")
+     DEF(TOK___ledf2, "__ledf2")
+     DEF(TOK___gtsf2, "__gtsf2")
+     DEF(TOK___gtdf2, "__gtdf2")
+     DEF(TOK___gesf2, "__gesf2")
+     DEF(TOK___gedf2, "__gedf2")
+     DEF(TOK___floatsisf, "__floatsisf")
+     DEF(TOK___floatsidf, "__floatsidf")
+     DEF(TOK___floatunsisf, "__floatunsisf")
+     DEF(TOK___floatunsidf, "__floatunsidf")
+     DEF(TOK___floatdisf, "__floatdisf")
+     DEF(TOK___floatdidf, "__floatdidf")
+     DEF(TOK___fixsfsi, "__fixsfsi")
+     DEF(TOK___fixdfsi, "__fixdfsi")
+     DEF(TOK___fixunssfsi, "__fixunssfsi")
+     DEF(TOK___fixunsdfsi, "__fixunsdfsi")
+     DEF(TOK___extendsfdf2, "__extendsfdf2")
+     DEF(TOK___truncdfsf2, "__truncdfsf2")
 #endif
 
 #if defined TCC_TARGET_I386 || defined TCC_TARGET_X86_64
@@ -544,3 +544,130 @@ ST_FUNC void gen_makedeps(TCCState *s, const char *target, const char *filename)
 }
 
 /* -------------------------------------------------------------- */
+/* run the commands 'cmds' (tcc -j workers), at most 'nb_jobs' at a time,
+   -1 for one per processor. No new command is started after one failed. */
+
+#ifdef _WIN32
+#include <process.h>
+
+static char *job_quote(const char *a)
+{
+    /* _spawnv() joins the arguments with spaces */
+    char *q, *d;
+    int n = 0;
+
+    if (*a && !strpbrk(a, " \t\""))
+        return tcc_strdup(a);
+    q = d = tcc_malloc(2 * strlen(a) + 3);
+    *d++ = '"';
+    for (; *a; ++a) {
+        /* backslashes are literal unless a quote follows */
+        if (*a == '"')
+            for (++n; n; --n)
+                *d++ = '\\';
+        n = *a == '\\' ? n + 1 : 0;
+        *d++ = *a;
+    }
+    for (; n; --n) /* before the closing quote */
+        *d++ = '\\';
+    *d++ = '"';
+    *d = 0;
+    return q;
+}
+
+static HANDLE job_start(char **argv)
+{
+    char program[MAX_PATH], **q = NULL;
+    int n = 0;
+    intptr_t h;
+
+    GetModuleFileNameA(NULL, program, sizeof program);
+    for (; *argv; ++argv)
+        dynarray_add(&q, &n, job_quote(*argv));
+    dynarray_add(&q, &n, NULL);
+    h = _spawnv(P_NOWAIT, program, (const char *const*)q);
+    dynarray_reset(&q, &n);
+    return h == -1 ? NULL : (HANDLE)h;
+}
+
+static int nb_processors(void)
+{
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return si.dwNumberOfProcessors;
+}
+#else
+#include <sys/wait.h>
+
+static int job_start(char **argv)
+{
+    int pid = fork();
+    if (pid == 0) {
+        execvp(argv[0], argv);
+        perror(argv[0]);
+        _exit(127);
+    }
+    return pid < 0 ? 0 : pid;
+}
+
+static int nb_processors(void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? n : 1;
+}
+#endif
+
+ST_FUNC int tcc_tool_jobs(char ***cmds, int nb_cmds, int nb_jobs)
+{
+    int i = 0, running = 0, ret = 0;
+#ifdef _WIN32
+    HANDLE procs[MAXIMUM_WAIT_OBJECTS];
+    DWORD w, code;
+#else
+    int status;
+#endif
+
+    if (nb_jobs < 0)
+        nb_jobs = nb_processors();
+    if (nb_jobs < 1)
+        nb_jobs = 1;
+#ifdef _WIN32
+    if (nb_jobs > MAXIMUM_WAIT_OBJECTS)
+        nb_jobs = MAXIMUM_WAIT_OBJECTS;
+#endif
+    fflush(stdout);
+    for (;;) {
+        if (!ret && i < nb_cmds && running < nb_jobs) {
+#ifdef _WIN32
+            if (NULL != (procs[running] = job_start(cmds[i])))
+#else
+            if (job_start(cmds[i]))
+#endif
+                ++running;
+            else
+                fprintf(stderr, "tcc: could not run '%s'\n", cmds[i][0]), ret = 1;
+            ++i;
+            continue;
+        }
+        if (!running)
+            break;
+#ifdef _WIN32
+        w = WaitForMultipleObjects(running, procs, FALSE, INFINITE) - WAIT_OBJECT_0;
+        if (w >= (DWORD)running)
+            return 1;
+        if (!GetExitCodeProcess(procs[w], &code) || code)
+            ret = 1;
+        CloseHandle(procs[w]);
+        procs[w] = procs[--running];
+#else
+        if (wait(&status) < 0)
+            return 1;
+        --running;
+        if (!WIFEXITED(status) || WEXITSTATUS(status))
+            ret = 1;
+#endif
+    }
+    return ret;
+}
+
+/* -------------------------------------------------------------- */
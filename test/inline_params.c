@@ -0,0 +1,42 @@
+/* Parameters of inlined functions (-finline-functions) must stay copies:
+ * a body that writes a parameter, or takes its address, must not change
+ * the caller's variable. Freestanding i386 Linux program; the exit status
+ * is the number of failed checks. */
+
+static int failures;
+
+static void check(int ok) { if (!ok) failures++; }
+
+static void inc(int *p) { *p = *p + 1; }
+static int through_address(int a) { inc(&a); return a; }
+static int post_increment(int a) { a++; return a; }
+static int pre_decrement(int a) { return --a; }
+static int assign(int a) { a = a * 3; return a; }
+static int sq(int a) { return a * a; }
+static int sum(int a, int b) { return a + b; }
+
+static void sys_exit(int code)
+{
+    __asm__ volatile ("int $0x80" : : "a"(1), "b"(code));
+}
+
+void _start(void)
+{
+    int x = 1, y;
+
+    y = through_address(x);
+    check(y == 2);
+    check(x == 1);
+    y = post_increment(x);
+    check(y == 2);
+    check(x == 1);
+    y = pre_decrement(x);
+    check(y == 0);
+    check(x == 1);
+    y = assign(x);
+    check(y == 3);
+    check(x == 1);
+    check(sq(x + 2) == 9);
+    check(sum(x, sq(x)) == 2);
+    sys_exit(failures);
+}